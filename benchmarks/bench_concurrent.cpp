@@ -0,0 +1,135 @@
+/**
+ *  @file bench_concurrent.cpp
+ *  @brief Source file measuring how ConcurrentTable read throughput scales with reader threads.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <easylua_concurrent.hpp>
+
+//! How many keys the tables hold.
+static const int BENCH_KEYS = 4096;
+
+//! How long every measurement runs for.
+static const std::chrono::milliseconds BENCH_DURATION(500);
+
+/**
+ *  @brief Runs readers against a table while one writer keeps updating it.
+ *  @param readers The number of reader threads.
+ *  @param read Performs a single read of the given key index from the given reader thread state.
+ *  @param write Performs a single write of the given key index.
+ *  @return The total reads per second across all readers.
+ */
+template <typename stateType, typename readType, typename writeType>
+static double measure(const unsigned int& readers, readType read, writeType write)
+{
+    std::atomic<bool> running(true);
+    std::atomic<unsigned long long> total(0);
+
+    std::thread writer([&running, &write]()
+    {
+        for (int index = 0; running.load(std::memory_order_relaxed); index = (index + 1) % BENCH_KEYS)
+            write(index);
+    });
+
+    std::vector<std::thread> threads;
+    for (unsigned int reader = 0; reader < readers; ++reader)
+    {
+        threads.emplace_back([&running, &total, &read, reader]()
+        {
+            stateType state;
+            unsigned long long reads = 0;
+
+            for (int index = static_cast<int>(reader) * 131; running.load(std::memory_order_relaxed); index = (index + 7) % BENCH_KEYS, ++reads)
+                read(state, index);
+
+            total += reads;
+        });
+    }
+
+    std::this_thread::sleep_for(BENCH_DURATION);
+    running.store(false);
+
+    writer.join();
+    for (auto it = threads.begin(); it != threads.end(); it++)
+        (*it).join();
+
+    return total.load() / std::chrono::duration<double>(BENCH_DURATION).count();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> keys;
+    for (int index = 0; index < BENCH_KEYS; ++index)
+        keys.push_back("Key" + std::to_string(index));
+
+    EasyLua::ConcurrentTable concurrent;
+    EasyLua::Table locked;
+    std::mutex lock;
+
+    for (int index = 0; index < BENCH_KEYS; ++index)
+    {
+        concurrent.set(keys[index], index);
+        locked.set(keys[index], index);
+    }
+
+    // Reader slots are per thread, so every reader thread lazily registers its own
+    struct ConcurrentState
+    {
+        std::unique_ptr<EasyLua::ConcurrentTable::Reader> reader;
+    };
+
+    struct LockedState { };
+
+    const unsigned int maximum = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 8;
+
+    std::printf("%8s %20s %20s\n", "readers", "concurrent reads/s", "mutex reads/s");
+
+    for (unsigned int readers = 1; readers <= maximum; readers *= 2)
+    {
+        const double concurrentRate = measure<ConcurrentState>(readers, [&concurrent, &keys](ConcurrentState& state, const int& index)
+        {
+            if (!state.reader)
+                state.reader.reset(new EasyLua::ConcurrentTable::Reader(concurrent));
+
+            int value;
+            concurrent.get(*state.reader, keys[index], value);
+        },
+        [&concurrent, &keys](const int& index)
+        {
+            concurrent.set(keys[index], index);
+        });
+
+        const double lockedRate = measure<LockedState>(readers, [&locked, &lock, &keys](LockedState& state, const int& index)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+
+            int value;
+            locked.get(keys[index], value);
+        },
+        [&locked, &lock, &keys](const int& index)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            locked.set(keys[index], index);
+        });
+
+        std::printf("%8u %20.0f %20.0f\n", readers, concurrentRate, lockedRate);
+    }
+
+    return 0;
+}
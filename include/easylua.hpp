@@ -14,6 +14,7 @@
 #define _INCLUDE_EASYLUA_HPP_
 
 #include <assert.h>
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 #include <tuple>
@@ -21,7 +22,19 @@
 #include <string>
 #include <cstring>
 #include <unordered_map>
+#include <unordered_set>
 #include <type_traits>
+#include <string_view>
+#include <vector>
+#include <iterator>
+#include <limits>
+#include <array>
+#include <map>
+#include <optional>
+#include <utility>
+#include <chrono>
+#include <atomic>
+#include <memory>
 
 #include <lua.hpp>
 
@@ -57,6 +70,500 @@ namespace EasyLua
 
     class Table;
 
+    /**
+     *  @brief Restores the top of the Lua stack when leaving scope, including when leaving through an
+     *  exception, so that early exits never leave stray values behind.
+     *  @code
+     *      EasyLua::StackGuard guard(lua);
+     *      lua_getglobal(lua, "config");
+     *      readConfig(lua); // May throw; the stack is restored either way
+     *  @endcode
+     */
+    class StackGuard
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor. Records the current top of the stack.
+             *  @param lua The Lua state to guard.
+             */
+            explicit StackGuard(lua_State* lua) : mLua(lua), mTop(lua_gettop(lua)) { }
+
+            //! Standard destructor. Restores the recorded top unless the guard was released.
+            ~StackGuard(void)
+            {
+                if (mLua)
+                    lua_settop(mLua, mTop);
+            }
+
+            StackGuard(const StackGuard& other) = delete;
+            StackGuard& operator=(const StackGuard& other) = delete;
+
+            //! Returns the top of the stack recorded at construction.
+            int top(void) const { return mTop; }
+
+            //! Returns the number of values pushed since construction.
+            int pushed(void) const { return mLua ? lua_gettop(mLua) - mTop : 0; }
+
+            //! Keeps everything pushed since construction, leaving the stack alone on scope exit.
+            void release(void) { mLua = nullptr; }
+
+        // Private Members
+        private:
+            //! The guarded state, or nullptr once released.
+            lua_State* mLua;
+
+            //! The top of the stack to restore.
+            int mTop;
+    };
+
+    /**
+     *  @brief The Converter template struct is the single point through which EasyLua moves values
+     *  between C++ and the Lua stack. Every push and read performed by pushParameters, pushTable,
+     *  pushArray, readStack and readColumns is resolved to the converter of the value's type at compile
+     *  time, so each type is marshalled by exactly one inlined code path with no runtime type switch.
+     *  @note Custom types are supported by specializing this template in the EasyLua namespace. A
+     *  specialization provides the following static members:
+     *  - void push(lua_State* lua, const type& value), pushing exactly one value.
+     *  - bool check(lua_State* lua, const int& index), returning whether the value at the index can be read.
+     *  - type read(lua_State* lua, const int& index), reading a value that passed check.
+     *  - constexpr const char* name, a description of the expected Lua value used in error messages.
+     *  Types that are only ever pushed may omit check and read. The second template parameter exists for
+     *  std::enable_if constrained partial specializations.
+     */
+    template <typename type, typename enable = void>
+    struct Converter
+    {
+        static_assert(sizeof(type*) == 0, "No EasyLua::Converter specialization exists for this type!");
+    };
+
+    namespace Resolvers
+    {
+        static const char *ELEMENT_EXCEPTION_FORMAT = "Expected %s for table %s! Got %s instead.";
+
+        /**
+         *  @brief Throws the error for a table element that could not be converted.
+         *  @param lua A pointer to the lua_State to use for this operation.
+         *  @param expected The name of the expected value.
+         *  @param element A description of the element, such as "key".
+         *  @param index The stack index of the offending value.
+         */
+        static INLINE void throwElementError(lua_State* lua, const char* expected, const char* element, const int& index)
+        {
+            char error[256];
+            snprintf(error, sizeof(error), ELEMENT_EXCEPTION_FORMAT, expected, element, luaL_typename(lua, index));
+
+            throw std::runtime_error(error);
+        }
+
+        /**
+         *  @brief Reads a Lua number as an integral type without any undefined or wrapping conversion.
+         *  @param lua A pointer to the lua_State to use for this operation.
+         *  @param index The stack index of the value.
+         *  @param out The value read, written only on success.
+         *  @return Whether the value is a number holding an integer that fits the type. NaN, infinities
+         *  and floats with a fractional part never do.
+         */
+        template <typename type>
+        static INLINE bool readInteger(lua_State* lua, const int& index, type& out)
+        {
+            if (lua_type(lua, index) != LUA_TNUMBER)
+                return false;
+
+            // Floats only convert when they hold an exact integer that fits a lua_Integer
+            int isInteger = 0;
+            const lua_Integer value = lua_tointegerx(lua, index, &isInteger);
+            if (!isInteger)
+                return false;
+
+            if constexpr (std::is_signed<type>::value)
+            {
+                if constexpr (sizeof(type) < sizeof(lua_Integer))
+                    if (value < static_cast<lua_Integer>(std::numeric_limits<type>::min()) || value > static_cast<lua_Integer>(std::numeric_limits<type>::max()))
+                        return false;
+            }
+            else
+            {
+                if (value < 0)
+                    return false;
+
+                if constexpr (sizeof(type) < sizeof(lua_Integer))
+                    if (value > static_cast<lua_Integer>(std::numeric_limits<type>::max()))
+                        return false;
+            }
+
+            out = static_cast<type>(value);
+            return true;
+        }
+
+        /**
+         *  @brief Reads the element at the given array position of a table through its converter.
+         *  @param lua A pointer to the lua_State to use for this operation.
+         *  @param table The absolute stack index of the table.
+         *  @param position The one based array position to read.
+         *  @throw std::runtime_error Thrown when the element cannot be converted. The element is left on
+         *  the stack in that case; the container converters restore the stack themselves.
+         */
+        template <typename type>
+        static INLINE type readArrayElement(lua_State* lua, const int& table, const size_t& position)
+        {
+            lua_rawgeti(lua, table, static_cast<lua_Integer>(position));
+
+            if (!EasyLua::Converter<type>::check(lua, -1))
+            {
+                char element[32];
+                snprintf(element, sizeof(element), "element %u", static_cast<unsigned int>(position));
+                throwElementError(lua, EasyLua::Converter<type>::name, element, -1);
+            }
+
+            type result = EasyLua::Converter<type>::read(lua, -1);
+            lua_pop(lua, 1);
+            return result;
+        }
+
+        /**
+         *  @brief The converter shared by the associative containers. Maps are pushed as tables presized
+         *  for their record count and read back with lua_next.
+         */
+        template <typename mapType>
+        struct MapConverter
+        {
+            typedef typename mapType::key_type keyType;
+            typedef typename mapType::mapped_type valueType;
+
+            static constexpr const char* name = "table (map)";
+
+            static INLINE void push(lua_State* lua, const mapType& value)
+            {
+                lua_createtable(lua, 0, static_cast<int>(value.size()));
+
+                for (const auto& entry : value)
+                {
+                    EasyLua::Converter<keyType>::push(lua, entry.first);
+                    EasyLua::Converter<valueType>::push(lua, entry.second);
+                    lua_rawset(lua, -3);
+                }
+            }
+
+            static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TTABLE; }
+
+            static INLINE mapType read(lua_State* lua, const int& index)
+            {
+                EasyLua::StackGuard guard(lua);
+                const int table = lua_absindex(lua, index);
+                mapType result;
+
+                lua_pushnil(lua);
+                while (lua_next(lua, table) != 0)
+                {
+                    // The key must never be converted in place, as that would confuse lua_next
+                    if (!EasyLua::Converter<keyType>::check(lua, -2))
+                        throwElementError(lua, EasyLua::Converter<keyType>::name, "key", -2);
+                    if (!EasyLua::Converter<valueType>::check(lua, -1))
+                        throwElementError(lua, EasyLua::Converter<valueType>::name, "value", -1);
+
+                    result.emplace(EasyLua::Converter<keyType>::read(lua, -2), EasyLua::Converter<valueType>::read(lua, -1));
+                    lua_pop(lua, 1);
+                }
+
+                return result;
+            }
+        };
+
+        /**
+         *  @brief The converter shared by std::tuple and std::pair. Both are pushed as arrays holding
+         *  one element per member.
+         */
+        template <typename tupleType, typename... types>
+        struct TupleConverter
+        {
+            static constexpr const char* name = "table (array)";
+
+            template <size_t... elements>
+            static INLINE void push(lua_State* lua, const tupleType& value, std::index_sequence<elements...>)
+            {
+                lua_createtable(lua, static_cast<int>(sizeof...(types)), 0);
+                ((EasyLua::Converter<types>::push(lua, std::get<elements>(value)), lua_rawseti(lua, -2, static_cast<lua_Integer>(elements + 1))), ...);
+            }
+
+            static INLINE void push(lua_State* lua, const tupleType& value) { push(lua, value, std::index_sequence_for<types...>()); }
+
+            static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TTABLE; }
+
+            template <size_t... elements>
+            static INLINE tupleType read(lua_State* lua, const int& table, std::index_sequence<elements...>)
+            {
+                // Braced initialization guarantees the elements are read in order
+                return tupleType{readArrayElement<types>(lua, table, elements + 1)...};
+            }
+
+            static INLINE tupleType read(lua_State* lua, const int& index)
+            {
+                EasyLua::StackGuard guard(lua);
+                return read(lua, lua_absindex(lua, index), std::index_sequence_for<types...>());
+            }
+        };
+    }
+
+    //! Integral types other than bool are exchanged as Lua integers.
+    template <typename type>
+    struct Converter<type, typename std::enable_if<std::is_integral<type>::value && !std::is_same<type, bool>::value>::type>
+    {
+        static constexpr const char* name = "integer (number)";
+
+        static INLINE void push(lua_State* lua, const type& value) { lua_pushinteger(lua, static_cast<lua_Integer>(value)); }
+
+        static INLINE bool check(lua_State* lua, const int& index)
+        {
+            type value;
+            return EasyLua::Resolvers::readInteger(lua, index, value);
+        }
+
+        //! Throws std::runtime_error when the value is not an integer in range of the type.
+        static INLINE type read(lua_State* lua, const int& index)
+        {
+            type result;
+            if (!EasyLua::Resolvers::readInteger(lua, index, result))
+                throw std::runtime_error("Number is not an integer in range!");
+            return result;
+        }
+    };
+
+    //! Floating point types are exchanged as Lua numbers.
+    template <typename type>
+    struct Converter<type, typename std::enable_if<std::is_floating_point<type>::value>::type>
+    {
+        static constexpr const char* name = "float (number)";
+
+        static INLINE void push(lua_State* lua, const type& value) { lua_pushnumber(lua, static_cast<lua_Number>(value)); }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TNUMBER; }
+
+        static INLINE type read(lua_State* lua, const int& index) { return static_cast<type>(lua_tonumber(lua, index)); }
+    };
+
+    //! Enumerations are exchanged as Lua integers holding their underlying value.
+    template <typename type>
+    struct Converter<type, typename std::enable_if<std::is_enum<type>::value>::type>
+    {
+        typedef typename std::underlying_type<type>::type underlyingType;
+
+        static constexpr const char* name = "enumeration (number)";
+
+        static INLINE void push(lua_State* lua, const type& value) { lua_pushinteger(lua, static_cast<lua_Integer>(static_cast<underlyingType>(value))); }
+
+        static INLINE bool check(lua_State* lua, const int& index)
+        {
+            underlyingType value;
+            return EasyLua::Resolvers::readInteger(lua, index, value);
+        }
+
+        //! Throws std::runtime_error when the value is not an integer in range of the underlying type.
+        static INLINE type read(lua_State* lua, const int& index)
+        {
+            underlyingType result;
+            if (!EasyLua::Resolvers::readInteger(lua, index, result))
+                throw std::runtime_error("Number is not an integer in range!");
+            return static_cast<type>(result);
+        }
+    };
+
+    template <>
+    struct Converter<bool>
+    {
+        static constexpr const char* name = "boolean";
+
+        static INLINE void push(lua_State* lua, const bool& value) { lua_pushboolean(lua, value); }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TBOOLEAN; }
+
+        static INLINE bool read(lua_State* lua, const int& index) { return lua_toboolean(lua, index) != 0; }
+    };
+
+    /**
+     *  @brief Strings read as const char* point into Lua owned memory.
+     *  @warning The returned pointer is only valid for as long as the string remains on the stack.
+     */
+    template <>
+    struct Converter<const char*>
+    {
+        static constexpr const char* name = "string";
+
+        static INLINE void push(lua_State* lua, const char* const& value) { lua_pushstring(lua, value); }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TSTRING; }
+
+        static INLINE const char* read(lua_State* lua, const int& index) { return lua_tostring(lua, index); }
+    };
+
+    //! Mutable strings may be pushed but never read, as Lua strings are immutable.
+    template <>
+    struct Converter<char*>
+    {
+        static constexpr const char* name = "string";
+
+        static INLINE void push(lua_State* lua, char* const& value) { lua_pushstring(lua, value); }
+    };
+
+    template <>
+    struct Converter<std::string>
+    {
+        static constexpr const char* name = "string";
+
+        static INLINE void push(lua_State* lua, const std::string& value) { lua_pushlstring(lua, value.data(), value.size()); }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TSTRING; }
+
+        static INLINE std::string read(lua_State* lua, const int& index)
+        {
+            size_t length = 0;
+            const char* value = lua_tolstring(lua, index, &length);
+            return std::string(value, length);
+        }
+    };
+
+    /**
+     *  @brief Strings read as std::string_view point into Lua owned memory without copying.
+     *  @warning The returned view is only valid for as long as the string remains reachable in Lua.
+     */
+    template <>
+    struct Converter<std::string_view>
+    {
+        static constexpr const char* name = "string";
+
+        static INLINE void push(lua_State* lua, const std::string_view& value) { lua_pushlstring(lua, value.data(), value.size()); }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TSTRING; }
+
+        static INLINE std::string_view read(lua_State* lua, const int& index)
+        {
+            size_t length = 0;
+            const char* value = lua_tolstring(lua, index, &length);
+            return std::string_view(value, length);
+        }
+    };
+
+    //! Raw pointers are pushed as light userdata. Both light and full userdata may be read.
+    template <>
+    struct Converter<void*>
+    {
+        static constexpr const char* name = "user data";
+
+        static INLINE void push(lua_State* lua, void* const& value) { lua_pushlightuserdata(lua, value); }
+
+        static INLINE bool check(lua_State* lua, const int& index)
+        {
+            const int type = lua_type(lua, index);
+            return type == LUA_TUSERDATA || type == LUA_TLIGHTUSERDATA;
+        }
+
+        static INLINE void* read(lua_State* lua, const int& index) { return lua_touserdata(lua, index); }
+    };
+
+    //! Empty optionals are exchanged as nil.
+    template <typename type>
+    struct Converter<std::optional<type>>
+    {
+        static constexpr const char* name = EasyLua::Converter<type>::name;
+
+        static INLINE void push(lua_State* lua, const std::optional<type>& value)
+        {
+            if (value)
+                EasyLua::Converter<type>::push(lua, *value);
+            else
+                lua_pushnil(lua);
+        }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_isnoneornil(lua, index) || EasyLua::Converter<type>::check(lua, index); }
+
+        static INLINE std::optional<type> read(lua_State* lua, const int& index)
+        {
+            if (lua_isnoneornil(lua, index))
+                return std::nullopt;
+            return EasyLua::Converter<type>::read(lua, index);
+        }
+    };
+
+    //! Vectors are exchanged as arrays, presized when pushed.
+    template <typename type, typename allocator>
+    struct Converter<std::vector<type, allocator>>
+    {
+        static constexpr const char* name = "table (array)";
+
+        static INLINE void push(lua_State* lua, const std::vector<type, allocator>& value)
+        {
+            lua_createtable(lua, static_cast<int>(value.size()), 0);
+
+            for (size_t position = 0; position < value.size(); ++position)
+            {
+                EasyLua::Converter<type>::push(lua, value[position]);
+                lua_rawseti(lua, -2, static_cast<lua_Integer>(position + 1));
+            }
+        }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TTABLE; }
+
+        static INLINE std::vector<type, allocator> read(lua_State* lua, const int& index)
+        {
+            EasyLua::StackGuard guard(lua);
+            const int table = lua_absindex(lua, index);
+            const size_t length = lua_rawlen(lua, table);
+
+            std::vector<type, allocator> result;
+            result.reserve(length);
+
+            for (size_t position = 1; position <= length; ++position)
+                result.push_back(EasyLua::Resolvers::readArrayElement<type>(lua, table, position));
+
+            return result;
+        }
+    };
+
+    //! Fixed size arrays are exchanged as arrays. Every element must be present when reading.
+    template <typename type, size_t size>
+    struct Converter<std::array<type, size>>
+    {
+        static constexpr const char* name = "table (array)";
+
+        static INLINE void push(lua_State* lua, const std::array<type, size>& value)
+        {
+            lua_createtable(lua, static_cast<int>(size), 0);
+
+            for (size_t position = 0; position < size; ++position)
+            {
+                EasyLua::Converter<type>::push(lua, value[position]);
+                lua_rawseti(lua, -2, static_cast<lua_Integer>(position + 1));
+            }
+        }
+
+        static INLINE bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TTABLE; }
+
+        static INLINE std::array<type, size> read(lua_State* lua, const int& index)
+        {
+            EasyLua::StackGuard guard(lua);
+            const int table = lua_absindex(lua, index);
+
+            std::array<type, size> result;
+
+            for (size_t position = 0; position < size; ++position)
+                result[position] = EasyLua::Resolvers::readArrayElement<type>(lua, table, position + 1);
+
+            return result;
+        }
+    };
+
+    template <typename key, typename value, typename compare, typename allocator>
+    struct Converter<std::map<key, value, compare, allocator>> : EasyLua::Resolvers::MapConverter<std::map<key, value, compare, allocator>> { };
+
+    template <typename key, typename value, typename hash, typename equal, typename allocator>
+    struct Converter<std::unordered_map<key, value, hash, equal, allocator>> : EasyLua::Resolvers::MapConverter<std::unordered_map<key, value, hash, equal, allocator>> { };
+
+    template <typename... types>
+    struct Converter<std::tuple<types...>> : EasyLua::Resolvers::TupleConverter<std::tuple<types...>, types...> { };
+
+    template <typename first, typename second>
+    struct Converter<std::pair<first, second>> : EasyLua::Resolvers::TupleConverter<std::pair<first, second>, first, second> { };
+
     /**
      *  @brief Namespace that contains all of the compile-time resolving code for EasyLua.
      *  The end programmer will not have to interface with anything here directly.
@@ -142,194 +649,296 @@ namespace EasyLua
         struct TableCreationResolver { };
 
         template <>
-        struct TableCreationResolver<true> { static INLINE void resolve(lua_State *lua) { lua_createtable(lua, 0, 0); } };
+        struct TableCreationResolver<true> { static INLINE void resolve(lua_State *lua, const int& arraySize, const int& recordSize) { lua_createtable(lua, arraySize, recordSize); } };
 
         template <>
-        struct TableCreationResolver<false> { static INLINE void resolve(lua_State *lua) { } };
+        struct TableCreationResolver<false> { static INLINE void resolve(lua_State *lua, const int& arraySize, const int& recordSize) { } };
 
-        // Type Checker
-        template <bool typeCheck, typename inputType>
-        struct StackReadResolver { };
+        static const char *EXCEPTION_FORMAT = "Expected %s at stack index %d! Got %s instead.";
 
-        static const char *EXCEPTION_FORMAT = "Expected %s (type ID %u) at stack index %u! Got type ID %u instead.";
-
-        template <>
-        struct StackReadResolver<true, int>
+        /**
+         *  @brief The StackReadResolver template struct reads a value from the stack through its
+         *  EasyLua::Converter, either throwing or reporting failure when the value has the wrong type.
+         */
+        template <bool typeCheck, typename type>
+        struct StackReadResolver
         {
-            static INLINE bool resolve(lua_State* lua, const int& index, int* out)
+            static INLINE bool resolve(lua_State* lua, const int& index, type* out)
             {
-                const int type = lua_type(lua, index);
-
-                if (type != LUA_TNUMBER)
+                if (!EasyLua::Converter<type>::check(lua, index))
                 {
-                    char error[256];
-                    sprintf(error, EXCEPTION_FORMAT, "integer (number) ", LUA_TNUMBER, index, type);
+                    if constexpr (typeCheck)
+                    {
+                        char error[256];
+                        snprintf(error, sizeof(error), EXCEPTION_FORMAT, EasyLua::Converter<type>::name, index, luaL_typename(lua, index));
 
-                    throw std::runtime_error(error);
+                        throw std::runtime_error(error);
+                    }
+
+                    return false;
                 }
 
-                *out = lua_tointeger(lua, index);
+                *out = EasyLua::Converter<type>::read(lua, index);
                 return true;
             }
         };
+    }
 
-        template <>
-        struct StackReadResolver<true, float>
+    namespace Resolvers
+    {
+        /**
+         *  @brief The ReadCountResolver template struct counts the stack values read by the outputs
+         *  passed to EasyLua::Utilities::readStack at compile time. Every output reads one value, except
+         *  a char buffer followed by its length, which together read one string.
+         */
+        template <typename... parameters>
+        struct ReadCountResolver
         {
-            static INLINE bool resolve(lua_State* lua, const int& index, float* out)
-            {
-                const int type = lua_type(lua, index);
-
-                if (type != LUA_TNUMBER)
-                {
-                    char error[256];
-                    sprintf(error, EXCEPTION_FORMAT, "float (number)", LUA_TNUMBER, index, type);
-
-                    throw std::runtime_error(error);
-                }
+            static constexpr int value = 0;
+        };
 
-                *out = lua_tonumber(lua, index);
-                return true;
-            }
+        template <typename type>
+        struct ReadCountResolver<type>
+        {
+            static constexpr int value = 1;
         };
 
-        template <>
-        struct StackReadResolver<true, char*>
+        template <typename first, typename second, typename... parameters>
+        struct ReadCountResolver<first, second, parameters...>
         {
-            static INLINE bool resolve(lua_State *lua, const int& index, char* out)
-            {
-                const int type = lua_type(lua, index);
+            static constexpr bool buffer = std::is_same<first, char*>::value && std::is_integral<second>::value;
+            static constexpr int value = buffer ? 1 + ReadCountResolver<parameters...>::value : 1 + ReadCountResolver<second, parameters...>::value;
+        };
+    }
 
-                if (type != LUA_TSTRING)
-                {
-                    char error[256];
-                    sprintf(error, EXCEPTION_FORMAT, "string", LUA_TSTRING, index, type);
+    class TaskPool;
 
-                    throw std::runtime_error(error);
-                }
+    /**
+     *  @brief A non-owning view of a single value stored in an EasyLua::Table, as yielded when iterating
+     *  a table. Nothing is copied; the view points straight at the stored value.
+     *  @warning The view is invalidated by any change to the key it was read from.
+     */
+    class TableValue
+    {
+        // Private Members
+        private:
+            //! The EasyLua type ID of the value.
+            unsigned char mType;
 
-                out = const_cast<char*>(lua_tostring(lua, index));
-                return true;
-            }
-        };
+            //! The stored value.
+            const void* mMemory;
 
-        template <>
-        struct StackReadResolver<true, int*>
-        {
-            static INLINE bool resolve(lua_State *lua, const int& index, void* out)
-            {
-                const int type = lua_type(lua, index);
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param type The EasyLua type ID of the value.
+             *  @param memory The stored value.
+             */
+            TableValue(const unsigned char& type, const void* memory) : mType(type), mMemory(memory) { }
 
-                if (type != LUA_TUSERDATA)
-                {
-                    char error[256];
-                    sprintf(error, EXCEPTION_FORMAT, "user data", LUA_TUSERDATA, index, type);
+            //! Returns the EasyLua type of the value.
+            EASYLUA_TYPE type(void) const { return static_cast<EASYLUA_TYPE>(mType); }
 
-                    throw std::runtime_error(error);
-                }
+            //! Returns whether the value is stored as the given type: int, float, std::string or EasyLua::Table.
+            template <typename valueType>
+            bool is(void) const { return mType == EasyLua::Resolvers::TypeIDResolver<valueType>::value; }
 
-                out = const_cast<void*>(lua_touserdata(lua, index));
-                return true;
-            }
-        };
+            /**
+             *  @brief Returns the value as the given type.
+             *  @return A pointer to the stored value, or nullptr if it is stored as a different type.
+             */
+            template <typename valueType>
+            const valueType* as(void) const { return this->is<valueType>() ? static_cast<const valueType*>(mMemory) : nullptr; }
+    };
 
-        // No exception
-        template <>
-        struct StackReadResolver<false, char*>
-        {
-            static INLINE bool resolve(lua_State* lua, const int& index, char* out)
-            {
-                const int type = lua_type(lua, index);
+    /**
+     *  @brief A class that represents Lua table objects. This can be used to read table
+     *  returns from the Lua runtime and it may also be used to pass table parameters to
+     *  method calls.
+     *  @note When using this for passing table parameters, please consider the performance
+     *  and memory requirements. So be sure to see if the more lightweight EasyLua::Utilities::Table
+     *  is applicable.
+     */
+    class Table
+    {
+        friend class TablePushJob;
+        friend struct TableProxy;
+        friend class Snapshot;
+        friend class ConcurrentTable;
 
-                if (type != LUA_TSTRING)
-                    return false;
+        // Private Members
+        private:
+            //! An unordered mapping of keys to stored tables.
+            std::unordered_map<std::string, Table*> mTables;
 
-                out = const_cast<char *>(lua_tostring(lua, index));
-                return true;
-            }
-        };
+            //! An unordered mapping of keys to arbitrary stored data.
+            std::unordered_map<std::string, void*> mContents;
 
-        template <>
-        struct StackReadResolver<false, float>
-        {
-            static INLINE bool resolve(lua_State* lua, const int& index, float* out)
-            {
-                const int type = lua_type(lua, index);
+            //! An unordering mapping of keys to type data.
+            std::unordered_map<std::string, std::pair<std::string, unsigned char>> mTypes;
 
-                if (type != LUA_TNUMBER)
-                    return false;
+            //! Keys that were written or removed since the last sync.
+            std::unordered_set<std::string> mDirtyKeys;
 
-                *out = lua_tonumber(lua, index);
-                return true;
-            }
-        };
+            //! The Lua state holding the table this table was last synced to.
+            lua_State* mSyncState;
 
-        template <>
-        struct StackReadResolver<false, int*>
-        {
-            static INLINE bool resolve(lua_State* lua, const int& index, void* out)
+            //! A registry reference to the Lua table this table was last synced to.
+            int mSyncReference;
+
+            //! Whether the state this table was last synced to is still open, shared by every table synced to it.
+            std::shared_ptr<bool> mSyncOpen;
+
+            //! A single slot of the frozen lookup.
+            struct FrozenEntry
             {
-                const int type = lua_type(lua, index);
+                //! The key, owned by mTypes.
+                const std::string* key;
+                //! The EasyLua type ID of the value.
+                unsigned char type;
+                //! The stored value, owned by mContents.
+                void* memory;
+            };
 
-                if (type != LUA_TUSERDATA)
-                    return false;
+            //! Whether the frozen lookup is in use.
+            bool mFrozen;
 
-                out = lua_touserdata(lua, index);
-                return true;
-            }
-        };
+            //! Per-bucket displacement seeds of the minimal perfect hash.
+            std::vector<uint64_t> mFrozenSeeds;
 
-        template <>
-        struct StackReadResolver<false, int>
-        {
-            static INLINE bool resolve(lua_State* lua, const int& index, int* out)
-            {
-                const int type = lua_type(lua, index);
+            //! All entries, ordered by their perfect hash slot.
+            std::vector<FrozenEntry> mFrozenEntries;
 
-                if (type != LUA_TNUMBER)
-                    return false;
+        // Private Methods
+        private:
+            /**
+             *  @brief Removes the value stored on the given key without marking it as dirty. Scalar
+             *  values are freed while subtables are only detached.
+             *  @param key The key to erase.
+             */
+            void erase(const std::string& key);
 
-                *out = lua_tointeger(lua, index);
-                return true;
-            }
-        };
+            /**
+             *  @brief Pushes a single stored value to the Lua stack.
+             *  @param lua The Lua state to push the value to.
+             *  @param type The EasyLua type ID of the value.
+             *  @param memory The stored value.
+             *  @param sync Whether subtables should be synced rather than pushed.
+             */
+            void pushValue(lua_State* lua, const unsigned char& type, void* memory, const bool& sync);
 
-        template <>
-        struct StackReadResolver<false, bool>
-        {
-            static INLINE bool resolve(lua_State* lua, const int& index, bool* out)
+            /**
+             *  @brief Looks up a key through the frozen lookup: one hash, one slot and one key comparison.
+             *  @param key The key to look up.
+             *  @return The entry, or nullptr if there is no such key.
+             */
+            const FrozenEntry* findFrozen(const std::string& key) const;
+
+            //! Returns whether the Lua table this table was last synced to is held in the given, still open state.
+            bool isSyncedTo(lua_State* lua) const { return mSyncState == lua && mSyncReference != LUA_NOREF && mSyncOpen && *mSyncOpen; }
+
+            /**
+             *  @brief Appends this table and its subtables to a serialized buffer.
+             *  @param out The buffer to append to.
+             *  @return The offset the node of this table was written at.
+             */
+            uint64_t serializeNode(std::string& out);
+
+            /**
+             *  @brief Copies the other table, throwing out any contents we may already have.
+             *  @param other The table to copy from.
+             *  @param subtables If not nullptr, subtables are created empty and queued here as pairs of the new
+             *  subtable and the subtable to copy into it, rather than being copied recursively.
+             */
+            void copyFrom(Table& other, std::vector<std::pair<Table*, Table*>>* subtables);
+
+        // Public Members
+        public:
+            //! A single entry yielded when iterating a table: the key and a view of its value.
+            typedef std::pair<std::string_view, TableValue> Entry;
+
+            /**
+             *  @brief A forward iterator over the entries of a table in no particular order. Keys and values
+             *  are viewed in place, so iterating allocates nothing. Frozen tables walk their packed entries
+             *  directly, while other tables resolve each value with one lookup.
+             *  @warning Any change to the table invalidates its iterators, freezing and unfreezing included.
+             */
+            class Iterator
             {
-                const int type = lua_type(lua, index);
+                // Public Members
+                public:
+                    typedef std::forward_iterator_tag iterator_category;
+                    typedef Entry value_type;
+                    typedef std::ptrdiff_t difference_type;
+                    typedef const Entry* pointer;
+                    typedef const Entry& reference;
+
+                // Private Members
+                private:
+                    //! The table being iterated.
+                    const Table* mTable;
+
+                    //! The current entry of an unfrozen table, or the end of its types if frozen.
+                    std::unordered_map<std::string, std::pair<std::string, unsigned char>>::const_iterator mCurrent;
+
+                    //! The current entry of a frozen table, or nullptr if unfrozen.
+                    const FrozenEntry* mFrozenCurrent;
+
+                    //! The entry currently pointed at.
+                    Entry mEntry;
+
+                // Private Methods
+                private:
+                    //! Points mEntry at the current entry, if there is one.
+                    void load(void)
+                    {
+                        if (mFrozenCurrent)
+                        {
+                            if (mFrozenCurrent != mTable->mFrozenEntries.data() + mTable->mFrozenEntries.size())
+                                mEntry = Entry(*mFrozenCurrent->key, TableValue(mFrozenCurrent->type, mFrozenCurrent->memory));
+                        }
+                        else if (mCurrent != mTable->mTypes.end())
+                            mEntry = Entry(mCurrent->first, TableValue(mCurrent->second.second, mTable->mContents.find(mCurrent->first)->second));
+                    }
 
-                if (type != LUA_TBOOLEAN)
-                    return false;
+                // Public Methods
+                public:
+                    /**
+                     *  @brief Constructor.
+                     *  @param table The table being iterated.
+                     *  @param current The current entry of an unfrozen table, or the end of its types if frozen.
+                     *  @param frozenCurrent The current entry of a frozen table, or nullptr if unfrozen.
+                     */
+                    Iterator(const Table* table, std::unordered_map<std::string, std::pair<std::string, unsigned char>>::const_iterator current, const FrozenEntry* frozenCurrent) : mTable(table), mCurrent(current), mFrozenCurrent(frozenCurrent), mEntry(std::string_view(), TableValue(0, nullptr))
+                    {
+                        this->load();
+                    }
+
+                    reference operator*(void) const { return mEntry; }
+                    pointer operator->(void) const { return &mEntry; }
 
-                *out = lua_toboolean(lua, index);
-                return true;
-            }
-        };
-    }
+                    Iterator& operator++(void)
+                    {
+                        if (mFrozenCurrent)
+                            ++mFrozenCurrent;
+                        else
+                            ++mCurrent;
 
-    /**
-     *  @brief A class that represents Lua table objects. This can be used to read table
-     *  returns from the Lua runtime and it may also be used to pass table parameters to
-     *  method calls.
-     *  @note When using this for passing table parameters, please consider the performance
-     *  and memory requirements. So be sure to see if the more lightweight EasyLua::Utilities::Table
-     *  is applicable.
-     */
-    class Table
-    {
-        // Private Members
-        private:
-            //! An unordered mapping of keys to stored tables.
-            std::unordered_map<std::string, Table*> mTables;
+                        this->load();
+                        return *this;
+                    }
 
-            //! An unordered mapping of keys to arbitrary stored data.
-            std::unordered_map<std::string, void*> mContents;
+                    Iterator operator++(int)
+                    {
+                        Iterator result = *this;
+                        ++(*this);
+                        return result;
+                    }
 
-            //! An unordering mapping of keys to type data.
-            std::unordered_map<std::string, std::pair<std::string, unsigned char>> mTypes;
+                    bool operator==(const Iterator& other) const { return mCurrent == other.mCurrent && mFrozenCurrent == other.mFrozenCurrent; }
+                    bool operator!=(const Iterator& other) const { return !(*this == other); }
+            };
 
         // Public Methods
         public:
@@ -342,7 +951,7 @@ namespace EasyLua
              */
             Table(Table& other);
 
-            //! Standard destructor.
+            //! Standard destructor. Drops the registry reference held by the last sync, unless that state was closed.
             ~Table(void);
 
             /**
@@ -351,6 +960,14 @@ namespace EasyLua
              */
             void copy(Table& other);
 
+            /**
+             *  @brief Copies the other table like copy, but copies independent subtrees in parallel on the given
+             *  pool. Every task fills only subtables it created itself, so no locking is involved.
+             *  @param other The table to copy from. It must not be modified during the copy.
+             *  @param pool The pool to copy on.
+             */
+            void copy(Table& other, TaskPool& pool);
+
             /**
              *  @brief Clears this table's contents, automatically freeing up any memory allocated
              *  along the way.
@@ -369,6 +986,138 @@ namespace EasyLua
              */
             void push(lua_State* lua);
 
+            /**
+             *  @brief Pushes this table to the Lua stack like push, but reuses the Lua table this table was
+             *  last synced to. Only keys that were written or removed since the last sync are written into it,
+             *  and subtables without changes are skipped entirely. The first sync against a given state builds
+             *  a complete table and keeps a registry reference to it.
+             *  @param lua The Lua state to sync this table to.
+             *  @note Scripts share the synced table, so any changes they make to it are visible to later syncs
+             *  only for keys that are not dirty on the C++ side.
+             *  @note Only one state is tracked at a time. Syncing to another state drops the reference held in
+             *  the previous one. Closing the state drops every reference held in it, so release is optional.
+             */
+            void sync(lua_State* lua);
+
+            /**
+             *  @brief Pushes a proxy userdata for this table to the Lua stack instead of converting it.
+             *  Scripts index, measure and iterate the proxy as if it were a read-only table, with every
+             *  lookup resolved directly against this table. Subtables only become proxies when accessed.
+             *  This makes passing large, read-mostly tables O(1).
+             *  @param lua The Lua state to push the proxy to.
+             *  @param cache Whether looked up values should be cached per proxy, keeping hot fields cheap. Cached
+             *  values will not reflect later changes to this table.
+             *  @note The length operator of a proxy yields the number of entries.
+             *  @warning This table must outlive every proxy pushed for it, including proxies still waiting
+             *  to be garbage collected.
+             */
+            void pushProxy(lua_State* lua, const bool& cache = false);
+
+            /**
+             *  @brief Drops the registry references held by this table and its subtables from previous syncs.
+             *  The next sync will build a complete table again.
+             *  @param lua The Lua state this table was synced to.
+             */
+            void release(lua_State* lua);
+
+            /**
+             *  @brief Returns whether this table or any of its subtables have changes that were not yet synced.
+             *  @return True if a sync would need to write anything.
+             */
+            bool isDirty(void) const;
+
+            /**
+             *  @brief Removes the property from the table if present. Subtables are detached but not deleted.
+             *  @param key The name of the property to remove.
+             */
+            void remove(const std::string& key);
+
+            /**
+             *  @brief Serializes this table and its subtables into the versioned binary format described by
+             *  EasyLua::MappedFormat, which EasyLua::TableMapping loads without parsing.
+             *  @return The serialized table.
+             */
+            std::string serialize(void);
+
+            /**
+             *  @brief Serializes this table and its subtables to a file.
+             *  @param path The file to write.
+             *  @throw std::runtime_error Thrown if the file could not be written.
+             */
+            void serialize(const std::string& path);
+
+            /**
+             *  @brief Freezes the current keys of this table behind a minimal perfect hash with all entries
+             *  packed into one contiguous array, so that get costs a single hash plus one key comparison.
+             *  Intended for tables that are written once and then read many times.
+             *  @note Any mutation of a frozen table unfreezes it again, at which point get falls back to the
+             *  regular lookup until freeze is called again.
+             *  @throw std::runtime_error Thrown in the extremely unlikely case no perfect hash could be found.
+             */
+            void freeze(void);
+
+            //! Drops the frozen lookup, if any.
+            void unfreeze(void);
+
+            //! Returns whether the frozen lookup is in use.
+            bool isFrozen(void) const { return mFrozen; }
+
+            //! Returns the number of entries in this table.
+            size_t size(void) const { return mTypes.size(); }
+
+            //! Returns an iterator to the first entry of this table.
+            Iterator begin(void) const
+            {
+                if (mFrozen)
+                    return Iterator(this, mTypes.end(), mFrozenEntries.data());
+                return Iterator(this, mTypes.begin(), nullptr);
+            }
+
+            //! Returns an iterator past the last entry of this table.
+            Iterator end(void) const
+            {
+                if (mFrozen)
+                    return Iterator(this, mTypes.end(), mFrozenEntries.data() + mFrozenEntries.size());
+                return Iterator(this, mTypes.end(), nullptr);
+            }
+
+            /**
+             *  @brief Walks the entries of this table in no particular order, calling the visitor for every
+             *  key and value without copying either.
+             *  @param visitor A callable overloaded on the value types it is interested in. Keys are passed as
+             *  std::string_view and values as const int&, const float&, std::string_view or const EasyLua::Table&.
+             *  Types must match exactly, so an int is never passed to a float overload; values the visitor has
+             *  no overload for are skipped. If an overload returns bool, returning false stops the walk.
+             *  @return True if the entire table was walked, false if the visitor stopped early.
+             *  @warning The visitor must not change this table.
+             */
+            template <typename visitorType>
+            bool visit(visitorType&& visitor) const;
+
+            /**
+             *  @brief Looks up the property in the table like get, but without throwing or copying.
+             *  @param key The name of the property to look up.
+             *  @return A pointer to the stored value, or nullptr if there is no such key or it is stored as a
+             *  different type. The pointer is invalidated by any change to the key.
+             */
+            template <typename outType>
+            const outType* tryGet(const std::string& key) const
+            {
+                constexpr unsigned char type = EasyLua::Resolvers::TypeIDResolver<outType>::value;
+
+                if (mFrozen)
+                {
+                    const FrozenEntry* entry = this->findFrozen(key);
+                    return entry && entry->type == type ? static_cast<const outType*>(entry->memory) : nullptr;
+                }
+
+                auto found = mTypes.find(key);
+                if (found == mTypes.end() || found->second.second != type)
+                    return nullptr;
+
+                return static_cast<const outType*>(mContents.find(key)->second);
+            }
+
             /**
              *  @brief Attaches a subtable to the table on the given property name.
              *  @param key The name of the property to attach the table to.
@@ -389,6 +1138,19 @@ namespace EasyLua
             {
                 constexpr unsigned char type = EasyLua::Resolvers::TypeIDResolver<outType>::value;
 
+                if (mFrozen)
+                {
+                    const FrozenEntry* entry = this->findFrozen(key);
+
+                    if (!entry)
+                        throw std::out_of_range("No such key!");
+                    else if (entry->type != type)
+                        throw std::runtime_error("Mismatched types!");
+
+                    out = *((outType*)(entry->memory));
+                    return;
+                }
+
                 if (mTypes.find(key) == mTypes.end())
                     throw std::out_of_range("No such key!");
                 else if (mTypes[key].second != type)
@@ -409,367 +1171,379 @@ namespace EasyLua
             {
                 storedType* memory = new storedType(value);
 
+                this->unfreeze();
+                this->erase(key);
+                if constexpr (std::is_same<storedType, Table>::value)
+                    mTables[key] = memory;
+
                 mContents[key] = memory;
                 constexpr unsigned char type = Resolvers::TypeIDResolver<storedType>::value;
                 mTypes[key] = std::make_pair(key, type);
+                mDirtyKeys.insert(key);
             }
     };
 
+    //! Strings are stored as std::string regardless of how they were passed in.
+    template <>
+    void Table::set(std::string key, char* value);
+
+    template <>
+    void Table::set(std::string key, const char* value);
+
+    //! Subtables are read out as deep copies.
+    template <>
+    void Table::get(const std::string& key, Table& out);
+
     /**
-     *  @brief This "namespace" contains a bulk of the EasyLua API that the end programmer
-     *  should be concerned with.
-     *  @note This is actually a class with static methods because of the usage of recursive
-     *  templates to resolve the Lua API calls.
+     *  @brief A resumable conversion of a Table tree into a Lua table. Rather than converting everything
+     *  in one recursive call like Table::push, the work is performed in steps that are bounded by entry
+     *  count or elapsed time so that very large tables may be staged across several frames.
+     *  @warning The Table being pushed must neither be modified nor destroyed while the job is running,
+     *  and the Lua state must outlive the job.
      */
-    class Utilities
+    class TablePushJob
     {
+        // Private Members
+        private:
+            //! Progress through a single table of the tree.
+            struct Frame
+            {
+                //! The table being converted.
+                Table* table;
+                //! The next entry of the table to convert.
+                std::unordered_map<std::string, std::pair<std::string, unsigned char>>::iterator current;
+                //! A registry reference to the Lua table being filled.
+                int reference;
+            };
+
+            //! The Lua state we are pushing to.
+            lua_State* mLua;
+
+            //! Explicit stack of tables being converted, replacing recursion.
+            std::vector<Frame> mFrames;
+
+            //! A registry reference to the root Lua table.
+            int mResult;
+
+            //! The number of entries converted so far.
+            size_t mConverted;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Converts entries until the job completes, the entry count is exhausted or the deadline
+             *  passes, whichever comes first.
+             *  @param entries The maximum number of entries to convert.
+             *  @param deadline The time at which to stop, checked every few entries.
+             *  @param timed Whether the deadline applies.
+             *  @return True if the job is complete.
+             */
+            bool advance(size_t entries, const std::chrono::steady_clock::time_point& deadline, const bool& timed);
+
         // Public Methods
         public:
             /**
-             *  @brief This is one among a family of methods that push arbitrary values to the
-             *  Lua stack.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @param in The current int to be pushing to the Lua stack.
-             *  @param params The rest of the parameters to be pushing to the Lua stack.
+             *  @brief Constructor accepting the table to convert. No conversion work is performed until
+             *  step is called.
+             *  @param lua The Lua state to push the table to.
+             *  @param table The root table to convert.
              */
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, const int& in, parameters... params)
-            {
-                lua_pushinteger(lua, in);
-                EasyLua::Utilities::pushParameters(lua, params...);
-            }
+            TablePushJob(lua_State* lua, Table& table);
+
+            //! Standard destructor. Releases any registry references still held by the job.
+            ~TablePushJob(void);
+
+            TablePushJob(const TablePushJob& other) = delete;
+            TablePushJob& operator=(const TablePushJob& other) = delete;
 
             /**
-             *  @brief This is one among a family of methods that push arbitrary values to the
-             *  Lua stack.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @param in The current float to be pushing to the Lua stack.
-             *  @param params The rest of the parameters to be pushing to the Lua stack.
+             *  @brief Converts up to the given number of entries.
+             *  @param entries The maximum number of entries to convert in this step.
+             *  @return True if the job is complete.
              */
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, const float& in, parameters... params)
-            {
-                lua_pushnumber(lua, in);
-                EasyLua::Utilities::pushParameters(lua, params...);
-            }
+            bool step(const size_t& entries);
 
             /**
-             *  @brief This is one among a family of methods that push arbitrary values to the
-             *  Lua stack.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @param in The current string to be pushing to the Lua stack.
-             *  @param params The rest of the parameters to be pushing to the Lua stack.
+             *  @brief Converts entries until the given amount of time has elapsed.
+             *  @param budget The amount of time this step may take.
+             *  @return True if the job is complete.
              */
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, const char* in, parameters... params)
-            {
-                lua_pushstring(lua, in);
-                EasyLua::Utilities::pushParameters(lua, params...);
-            }
+            bool step(const std::chrono::nanoseconds& budget);
+
+            //! Returns whether all entries were converted.
+            bool isComplete(void) const { return mFrames.empty(); }
+
+            //! Returns the number of entries converted so far.
+            size_t converted(void) const { return mConverted; }
 
             /**
-             *  @brief This is one among a family of methods that push arbitrary values to the
-             *  Lua stack.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @param in The current bool to be pushing to the Lua stack.
-             *  @param params The rest of the parameters to be pushing to the Lua stack.
+             *  @brief Pushes the finished table to the Lua stack.
+             *  @throw std::runtime_error Thrown when the job is not yet complete.
              */
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, const bool& in, parameters... params)
-            {
-                lua_pushboolean(lua, in);
-                EasyLua::Utilities::pushParameters(lua, params...);
-            }
+            void push(void);
+    };
 
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, Table& in, parameters... params)
-            {
-                in.push(lua);
-                EasyLua::Utilities::pushParameters(lua, params...);
-            }
+    /**
+     *  @brief A compile-time description of a Lua table made up of alternating keys and values, as
+     *  produced by EasyLua::Utilities::makeTable. The layout, including nested tables and the exact
+     *  size of every lua_createtable call, is resolved by the compiler; pushing the description emits
+     *  each table in its final position on the stack.
+     */
+    template <typename... parameters>
+    class TableBuilder
+    {
+        // Public Members
+        public:
+            //! The number of fields in the described table.
+            static constexpr int fieldCount = sizeof...(parameters) / 2;
 
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, Table* in, parameters... params)
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the alternating keys and values.
+             *  @param params The keys and values of the table.
+             */
+            TableBuilder(parameters... params) : mParameters(params...)
             {
-                in->push(lua);
-                EasyLua::Utilities::pushParameters(lua, params...);
+                static_assert(sizeof...(parameters) % 2 == 0, "Tables must be described with key and value pairs!");
             }
 
             /**
-             *  @brief This is one among a family of methods that push a table containing
-             *  arbitrary values to the Lua stack.
-             *  @param key The key to assign the value to so that { key = value }
-             *  @param value The int value to assign to our key in the table.
+             *  @brief Pushes the described table to the Lua stack.
              *  @param lua A pointer to the lua_State to use for this operation.
              */
-            template <bool createTable = true, typename... parameters>
-            static INLINE void pushTable(lua_State* lua, const char* key, const int& value, parameters... params)
-            {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
+            INLINE void push(lua_State* lua) const;
 
-                lua_pushstring(lua, key);
-                lua_pushinteger(lua, value);
-                lua_settable(lua, -3);
+        // Private Members
+        private:
+            //! The keys and values of the table.
+            std::tuple<parameters...> mParameters;
+    };
 
-                EasyLua::Utilities::pushTable<false>(lua, params...);
-            }
+    /**
+     *  @brief Tables are pushed as deep copies through Table::push.
+     *  @note Pushing does not modify the table's contents, only the bookkeeping used to sync it later.
+     */
+    template <>
+    struct Converter<Table>
+    {
+        static constexpr const char* name = "table";
 
-            /**
-             *  @brief This is one among a family of methods that push a table containing
-             *  arbitrary values to the Lua stack.
-             *  @param key The key to assign the value to so that { key = value }
-             *  @param value The float value to assign to our key in the table.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             */
-            template <bool createTable = true, typename... parameters>
-            static INLINE void pushTable(lua_State* lua, const char* key, const float& value, parameters... params)
-            {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
+        static INLINE void push(lua_State* lua, const Table& value) { const_cast<Table&>(value).push(lua); }
+    };
 
-                lua_pushstring(lua, key);
-                lua_pushnumber(lua, value);
-                lua_settable(lua, -3);
+    //! Table pointers are pushed like tables, with null pointers pushed as nil.
+    template <>
+    struct Converter<Table*>
+    {
+        static constexpr const char* name = "table";
 
-                EasyLua::Utilities::pushTable<false>(lua, params...);
-            }
+        static INLINE void push(lua_State* lua, Table* const& value)
+        {
+            if (value)
+                value->push(lua);
+            else
+                lua_pushnil(lua);
+        }
+    };
+
+    //! Table descriptions are emitted in place, nested tables included.
+    template <typename... members>
+    struct Converter<TableBuilder<members...>>
+    {
+        static constexpr const char* name = "table";
+
+        static INLINE void push(lua_State* lua, const TableBuilder<members...>& value) { value.push(lua); }
+    };
 
+    /**
+     *  @brief This "namespace" contains a bulk of the EasyLua API that the end programmer
+     *  should be concerned with.
+     *  @note This is actually a class with static methods because of the usage of recursive
+     *  templates to resolve the Lua API calls.
+     */
+    class Utilities
+    {
+        // Public Methods
+        public:
             /**
-             *  @brief This is one among a family of methods that push a table containing
-             *  arbitrary values to the Lua stack.
-             *  @param key The key to assign the value to so that { key = value }
-             *  @param value The double value to assign to our key in the table.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @note The double is probably downcasted to a float for this operation.
+             *  @brief Hashes a key with FNV-1a. This is the hash used by frozen tables and snapshots.
+             *  @param key The key to hash.
+             *  @return The hash.
              */
-            template <bool createTable = true, typename... parameters>
-            static INLINE void pushTable(lua_State* lua, const char* key, const double& value, parameters... params)
+            static INLINE uint64_t hashKey(const std::string_view& key)
             {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
+                uint64_t result = 14695981039346656037ULL;
 
-                lua_pushstring(lua, key);
-                lua_pushnumber(lua, value);
-                lua_settable(lua, -3);
+                for (auto it = key.begin(); it != key.end(); it++)
+                {
+                    result ^= static_cast<unsigned char>(*it);
+                    result *= 1099511628211ULL;
+                }
 
-                EasyLua::Utilities::pushTable<false>(lua, params...);
+                return result;
             }
 
             /**
-             *  @brief This is one among a family of methods that push a table containing
-             *  arbitrary values to the Lua stack.
-             *  @param key The key to assign the value to so that { key = value }
-             *  @param value The bool value to assign to our key in the table.
+             *  @brief Makes sure the Lua stack can hold the given number of additional values, plus the
+             *  LUA_MINSTACK slots converters may use transiently while pushing them. This is a single
+             *  lua_checkstack call, which the variadic pushes make once per operation.
              *  @param lua A pointer to the lua_State to use for this operation.
+             *  @throw std::runtime_error Thrown when the stack cannot be grown.
              */
-            template <bool createTable = true, typename... parameters>
-            static INLINE void *pushTable(lua_State* lua, const char* key, const bool& value, parameters... params)
+            template <int count>
+            static INLINE void reserveStack(lua_State* lua)
             {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushstring(lua, key);
-                lua_pushboolean(lua, value);
-                lua_settable(lua, -3);
+                static_assert(count >= 0, "Cannot reserve a negative number of stack slots!");
 
-                EasyLua::Utilities::pushTable<false>(lua, params...);
+                if constexpr (count > 0)
+                {
+                    if (!lua_checkstack(lua, count + LUA_MINSTACK))
+                        throw std::runtime_error("Unable to grow the Lua stack!");
+                }
             }
 
             /**
-             *  @brief This is one among a family of methods that push a table containing
-             *  arbitrary values to the Lua stack.
-             *  @param key The key to assign the value to so that { key = value }
-             *  @param value The string value to assign to our key in the table.
+             *  @brief Pushes arbitrary values to the Lua stack, each through the EasyLua::Converter
+             *  of its type. Stack space for every value is reserved once up front.
              *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param params The values to push to the Lua stack.
+             *  @throw std::runtime_error Thrown when the stack cannot be grown.
              */
-            template <bool createTable = true, typename... parameters>
-            static INLINE void pushTable(lua_State* lua, const char* key, const char* value, parameters... params)
+            template <typename... parameters>
+            static INLINE void pushParameters(lua_State* lua, const parameters&... params)
             {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushstring(lua, key);
-                lua_pushstring(lua, value);
-                lua_settable(lua, -3);
-
-                EasyLua::Utilities::pushTable<false>(lua, params...);
+                EasyLua::Utilities::reserveStack<static_cast<int>(sizeof...(parameters))>(lua);
+                EasyLua::Utilities::pushReserved(lua, params...);
             }
 
             /**
-             *  @brief A helper method that can be used to push more components to the
-             *  current table.
-             *  @param key The key to assign the value to so that { key = value }
-             *  @param value The string value to assign to our key in the table.
+             *  @brief Pushes arbitrary values like pushParameters, for callers that already reserved the
+             *  stack space for them with reserveStack.
              *  @param lua A pointer to the lua_State to use for this operation.
-             *  @note This simply calls EasyLua::Utilities::pushTable<false>(lua, params...)
+             *  @param params The values to push to the Lua stack.
              */
             template <typename... parameters>
-            static INLINE void pushTableComponents(lua_State* lua, parameters... params)
+            static INLINE void pushReserved(lua_State* lua, const parameters&... params)
             {
-                EasyLua::Utilities::pushTable<false>(lua, params...);
+                (EasyLua::Converter<typename std::decay<const parameters>::type>::push(lua, params), ...);
             }
 
             /**
-             *  @brief A helper method that can be used to push subtables to the Lua
-             *  stack when using the high performance interface.
-             *  @example subtables/main.cpp
+             *  @brief Pushes a table containing arbitrary values to the Lua stack, each value
+             *  being pushed through the EasyLua::Converter of its type.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param key The key to assign the value to so that { key = value }
+             *  @param value The value to assign to our key in the table.
+             *  @param params The rest of the alternating keys and values.
+             *  @note Nested tables described with makeTable are built in place and assigned directly,
+             *  so no stack rotation is ever necessary regardless of the nesting depth.
              */
-            template <int depth, typename... parameters>
-            static INLINE void *Table(lua_State* lua, parameters... params)
-            {
-                const size_t currentTop = lua_gettop(lua);
-
-                EasyLua::Utilities::pushTable<true>(lua, params...);
-
-                // TODO (Robert MacGregor#9): Statically resolve the necessity of this, it's only necessary for pushParameters
-                lua_insert(lua, depth); // Puts pushed tables in the right order for pushParameters
-
-                return nullptr;
-            }
-
-            // Array Pusher
-            template <bool createTable = true, unsigned int index = 1, typename... parameters>
-            static INLINE void pushArray(lua_State* lua, const int& value, parameters... params)
-            {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushinteger(lua, index);
-                lua_pushinteger(lua, value);
-                lua_settable(lua, -3);
-
-                EasyLua::Utilities::pushArray<false, index + 1>(lua, params...);
-            }
-
-            template <bool createTable = true, unsigned int index = 1, typename... parameters>
-            static INLINE void pushArray(lua_State* lua, const char* key, const float& value, parameters... params)
-            {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushinteger(lua, index);
-                lua_pushnumber(lua, value);
-                lua_settable(lua, -3);
-
-                EasyLua::Utilities::pushArray<false, index + 1>(lua, params...);
-            }
-
-            template <bool createTable = true, unsigned int index = 1, typename... parameters>
-            static INLINE void pushArray(lua_State* lua, const char* key, const double& value, parameters... params)
-            {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushinteger(lua, index);
-                lua_pushnumber(lua, value);
-                lua_settable(lua, -3);
-
-                EasyLua::Utilities::pushArray<false, index + 1>(lua, params...);
-            }
-
-            template <bool createTable = true, unsigned int index = 1, typename... parameters>
-            static INLINE void pushArray(lua_State *lua, const char* key, const bool& value, parameters... params)
-            {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushinteger(lua, index);
-                lua_pushboolean(lua, value);
-                lua_settable(lua, -3);
-
-                EasyLua::Utilities::pushArray<false, index + 1>(lua, params...);
-            }
-
-            template <bool createTable = true, unsigned int index = 1, typename... parameters>
-            static INLINE void pushArray(lua_State* lua, const char* key, const char* value, parameters... params)
+            template <bool createTable = true, typename type, typename... parameters>
+            static INLINE void pushTable(lua_State* lua, const char* key, const type& value, const parameters&... params)
             {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-
-                lua_pushinteger(lua, index);
-                lua_pushstring(lua, value);
-                lua_settable(lua, -3);
-
-                EasyLua::Utilities::pushArray<false, index + 1>(lua, params...);
-            }
-
-            template <bool createTable = true, unsigned int index = 1>
-            static INLINE void pushArray(lua_State* lua) { }
+                if constexpr (createTable)
+                    EasyLua::Utilities::reserveStack<1>(lua);
 
-            template <bool typeException, int index = 1, typename... parameters>
-            static INLINE int readStack(lua_State* lua, float* out, parameters... params)
-            {
-                if (sizeof...(parameters) > lua_gettop(lua))
-                    throw std::runtime_error("Not enough values to read (reading float)!");
+                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua, 0, sizeof...(parameters) / 2 + 1);
 
-                if (!EasyLua::Resolvers::StackReadResolver<typeException, float>::resolve(lua, index, out))
-                    return index;
+                EasyLua::Converter<typename std::decay<const type>::type>::push(lua, value);
+                lua_setfield(lua, -2, key);
 
-                *out = luaL_checknumber(lua, index);
-                return EasyLua::Utilities::readStack<typeException, index + 1>(lua, params...);
+                EasyLua::Utilities::pushTable<false>(lua, params...);
             }
 
-            template <bool typeException, int index = 1, typename... parameters>
-            static INLINE int readStack(lua_State* lua, bool* out, parameters... params)
+            /**
+             *  @brief A helper method that can be used to push more components to the
+             *  current table.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param params The alternating keys and values to assign.
+             *  @note This simply calls EasyLua::Utilities::pushTable<false>(lua, params...)
+             */
+            template <typename... parameters>
+            static INLINE void pushTableComponents(lua_State* lua, const parameters&... params)
             {
-                if (sizeof...(parameters) > lua_gettop(lua))
-                    throw std::runtime_error("Not enough values to read (reading bool)!");
-
-                EasyLua::Resolvers::StackReadResolver<typeException, bool>::resolve(lua, index, out);
-
-                *out = lua_toboolean(lua, index);
-                return EasyLua::Utilities::readStack<typeException, index + 1>(lua, params...);
+                EasyLua::Utilities::pushTable<false>(lua, params...);
             }
 
-            template <bool typeException, int index = 1, typename... parameters>
-            static INLINE int readStack(lua_State *lua, int* out, parameters... params)
+            /**
+             *  @brief A helper method that describes a table to be pushed to the Lua stack when
+             *  using the high performance interface. Nothing is pushed until the description is
+             *  handed to call, pcall, pushParameters or pushTable, at which point the table and
+             *  any nested tables are emitted in their final order.
+             *  @param params Alternating keys and values, where values may be further tables
+             *  described with makeTable.
+             *  @return The compile-time description of the table.
+             */
+            template <typename... parameters>
+            static INLINE EasyLua::TableBuilder<parameters...> makeTable(parameters... params)
             {
-                if (sizeof...(parameters) > lua_gettop(lua))
-                    throw std::runtime_error("Not enough values to read (reading int)!");
-
-                if (!EasyLua::Resolvers::StackReadResolver<typeException, int>::resolve(lua, index, out))
-                    return index;
-
-                return EasyLua::Utilities::readStack<typeException, index + 1>(lua, params...);
+                return EasyLua::TableBuilder<parameters...>(params...);
             }
 
-            template <bool typeException, int index = 1, typename... parameters>
-            static INLINE int readStack(lua_State* lua, char *out, const int &outLength, parameters... params)
+            /**
+             *  @brief A helper method that can be used to push subtables to the Lua
+             *  stack when using the high performance interface.
+             *  @note This is retained for compatibility and is equivalent to makeTable. Both the
+             *  depth and the Lua state are no longer needed since nesting is resolved at compile time.
+             *  @example subtables/main.cpp
+             */
+            template <int depth, typename... parameters>
+            static INLINE EasyLua::TableBuilder<parameters...> Table(lua_State* lua, parameters... params)
             {
-                if (sizeof...(parameters) > lua_gettop(lua))
-                    throw std::runtime_error("Not enough values to read (reading string)!");
-
-                if (!EasyLua::Resolvers::StackReadResolver<typeException, char *>::resolve(lua, index, out))
-                    return index;
-
-                // We want to read a string of max size outLength
-                const char *target = luaL_checkstring(lua, index);
-
-                // Copy the target memory to our out pointer
-                unsigned int targetLength = strlen(target);
-                targetLength = outLength > targetLength ? targetLength : targetLength - outLength;
-                memcpy(out, target, targetLength);
-
-                return EasyLua::Utilities::readStack<typeException, index + 1>(lua, params...);
+                return EasyLua::TableBuilder<parameters...>(params...);
             }
 
-            template <bool typeException, int index = 1, typename... parameters>
-            static INLINE int readStack(lua_State* lua, std::string *out, parameters... params)
+            /**
+             *  @brief Pushes an array containing arbitrary values to the Lua stack, each value
+             *  being pushed through the EasyLua::Converter of its type.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param value The value to store at the current index of the array.
+             *  @param params The rest of the values of the array.
+             */
+            template <bool createTable = true, unsigned int index = 1, typename type, typename... parameters>
+            static INLINE void pushArray(lua_State* lua, const type& value, const parameters&... params)
             {
-                if (sizeof...(parameters) > lua_gettop(lua))
-                    throw std::runtime_error("Not enough values to read (reading string)!");
-
-                char *outTest = 0x00;
+                if constexpr (createTable)
+                    EasyLua::Utilities::reserveStack<1>(lua);
 
-                if (!EasyLua::Resolvers::StackReadResolver<typeException, char *>::resolve(lua, index, outTest))
-                    return index;
+                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua, sizeof...(parameters) + 1, 0);
 
-                out->assign(luaL_checkstring(lua, index));
+                EasyLua::Converter<typename std::decay<const type>::type>::push(lua, value);
+                lua_rawseti(lua, -2, index);
 
-                return EasyLua::Utilities::readStack<typeException, index + 1>(lua, params...);
+                EasyLua::Utilities::pushArray<false, index + 1>(lua, params...);
             }
 
+            template <bool createTable = true, unsigned int index = 1>
+            static INLINE void pushArray(lua_State* lua) { }
+
+            /**
+             *  @brief Reads values from the stack starting at index 1, each through the EasyLua::Converter
+             *  of the type pointed to. A string may also be read into a caller provided char buffer by passing
+             *  the buffer followed by its size, including the terminator; it is always null terminated.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param params The outputs, one per value to read.
+             *  @return -1 if every value was read, otherwise the stack index of the first value of the wrong type
+             *  when typeException is false.
+             *  @throw std::runtime_error Thrown when there are not enough values on the stack, in which case nothing
+             *  is read, or when a value has the wrong type and typeException is true.
+             *  @note The number of values is computed at compile time, so the stack size is checked once per read.
+             */
             template <bool typeException, int index = 1, typename... parameters>
-            static INLINE int readStack(lua_State* lua, void* out, parameters... params)
+            static INLINE int readStack(lua_State* lua, parameters... params)
             {
-                if (sizeof...(parameters) > lua_gettop(lua))
-                    throw std::runtime_error("Not enough values to read (reading userdata)!");
+                constexpr int count = EasyLua::Resolvers::ReadCountResolver<parameters...>::value;
 
-                EasyLua::Resolvers::StackReadResolver<typeException, int *>::resolve(lua, index);
+                if (index + count - 1 > lua_gettop(lua))
+                {
+                    char error[256];
+                    snprintf(error, sizeof(error), "Not enough values to read (reading %d from index %d, have %d)!", count, index, lua_gettop(lua));
+
+                    throw std::runtime_error(error);
+                }
 
-                out = lua_touserdata(lua, index);
-                return EasyLua::Utilities::readStack<typeException, index + 1>(lua, params...);
+                return EasyLua::Utilities::readValues<typeException, index>(lua, params...);
             }
 
             static void printStack(lua_State* lua)
@@ -824,25 +1598,6 @@ namespace EasyLua
                 }
             }
 
-            /**
-             *  @brief This is one among a family of methods that push arbitrary values to the
-             *  Lua stack.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @param in This value is actually not used.
-             *  @param params The rest of the parameters to be pushing to the Lua stack.
-             *  @note The end programmer should not be using this method directly.
-             */
-            template <typename... parameters>
-            static INLINE void pushParameters(lua_State* lua, const void* value, parameters... params)
-            {
-                // Tables will stack at the bottom so we correct this as we run
-                lua_pushvalue(lua, 1);
-                lua_remove(lua, 1);
-
-                EasyLua::Utilities::pushParameters(lua, params...);
-            }
-
-
         // Private Methods
         private:
             //! Private constructor.
@@ -850,14 +1605,6 @@ namespace EasyLua
             //! Private destructor.
             ~Utilities(void) { }
 
-            /**
-             *  @brief This is one among a family of methods that push arbitrary values to the
-             *  Lua stack.
-             *  @param lua A pointer to the lua_State to use for this operation.
-             *  @note The end programmer should not be using this method directly.
-             */
-            static INLINE void pushParameters(lua_State* lua) { }
-
             /**
              *  @brief This is one among a family of methods that push an array containing
              *  arbitrary values to the Lua stack.
@@ -867,24 +1614,451 @@ namespace EasyLua
             template <bool createTable = true>
             static INLINE void pushTable(lua_State* lua) { }
 
-            template <bool createTable = true, typename... parameters>
-            static INLINE void pushTable(lua_State* lua, const char* key, const void* value, parameters... params)
+            /**
+             *  @brief Reads the value at the current stack index, then the rest. The stack size was already
+             *  checked by readStack.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param out Where to write the value at the current stack index.
+             *  @param params The rest of the outputs.
+             *  @return See readStack.
+             */
+            template <bool typeException, int index, typename type, typename... parameters>
+            static INLINE int readValues(lua_State* lua, type* out, parameters... params)
             {
-                EasyLua::Resolvers::TableCreationResolver<createTable>::resolve(lua);
-                EasyLua::Utilities::pushTable<false>(lua, params...);
+                if (!EasyLua::Resolvers::StackReadResolver<typeException, type>::resolve(lua, index, out))
+                    return index;
+
+                return EasyLua::Utilities::readValues<typeException, index + 1>(lua, params...);
+            }
+
+            /**
+             *  @brief Reads the string at the current stack index into a caller provided buffer, then the rest.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param out The buffer to copy the string to. It is always null terminated.
+             *  @param outLength The size of the buffer, including the terminator.
+             *  @param params The rest of the outputs.
+             *  @return See readStack.
+             */
+            template <bool typeException, int index, typename... parameters>
+            static INLINE int readValues(lua_State* lua, char* out, const int& outLength, parameters... params)
+            {
+                std::string_view value;
+                if (!EasyLua::Resolvers::StackReadResolver<typeException, std::string_view>::resolve(lua, index, &value))
+                    return index;
+
+                if (outLength > 0)
+                {
+                    const size_t length = std::min(value.size(), static_cast<size_t>(outLength - 1));
+                    memcpy(out, value.data(), length);
+                    out[length] = 0x00;
+                }
 
-                // We'll have two tables at the top and we need to swap them for correct assignment as
-                // the ordering will be inner then outer
-                lua_insert(lua, -2);
-                lua_pushstring(lua, key);
-                lua_insert(lua, -2);
-                lua_settable(lua, -3);
+                return EasyLua::Utilities::readValues<typeException, index + 1>(lua, params...);
             }
 
-            template <bool typeException, int index = -1>
-            static INLINE int readStack(lua_State* lua) { return -1; }
+            template <bool typeException, int index>
+            static INLINE int readValues(lua_State* lua) { return -1; }
     }; // End Class Utilities
 
+    template <typename... parameters>
+    INLINE void TableBuilder<parameters...>::push(lua_State* lua) const
+    {
+        lua_createtable(lua, 0, fieldCount);
+
+        if constexpr (sizeof...(parameters) != 0)
+            std::apply([lua](const parameters&... params) { EasyLua::Utilities::pushTableComponents(lua, params...); }, mParameters);
+    }
+
+    /**
+     *  @brief A lightweight, non-owning handle to a Lua table that lives on the Lua stack.
+     *  This is what EasyLua::forEach hands to visitors for nested tables so that they may
+     *  be walked in turn without ever materializing an EasyLua::Table.
+     *  @note A cursor is only valid for as long as the table it refers to remains at the
+     *  same position on the stack.
+     */
+    class TableCursor
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the table location.
+             *  @param lua A pointer to the lua_State the table lives in.
+             *  @param index The stack index of the table. Relative indices are resolved immediately.
+             */
+            TableCursor(lua_State* lua, const int& index) : mLua(lua), mIndex(lua_absindex(lua, index)) { }
+
+            //! Returns the lua_State this cursor refers to.
+            lua_State* state(void) const { return mLua; }
+
+            //! Returns the absolute stack index of the table.
+            int index(void) const { return mIndex; }
+
+            //! Returns the raw length (border of the array part) of the table.
+            size_t length(void) const { return lua_rawlen(mLua, mIndex); }
+
+            /**
+             *  @brief Walks the table, calling the visitor for each key and value pair.
+             *  @param visitor The visitor to invoke. See EasyLua::forEach.
+             *  @return True if the entire table was walked, false if the visitor stopped early.
+             */
+            template <typename visitorType>
+            bool forEach(visitorType&& visitor) const;
+
+        // Private Members
+        private:
+            //! The Lua state the table lives in.
+            lua_State* mLua;
+            //! The absolute stack index of the table.
+            int mIndex;
+    };
+
+    namespace Resolvers
+    {
+        /**
+         *  @brief Stands in for an argument of exactly the given type when checking which visitor overloads
+         *  apply. It converts to that type only, so overloads that would need an implicit conversion, such
+         *  as bool to lua_Number, are not considered.
+         */
+        template <typename type>
+        struct ExactArgument
+        {
+            template <typename target, typename = typename std::enable_if<std::is_same<target, type>::value>::type>
+            operator target(void) const;
+        };
+
+        /**
+         *  @brief The VisitResolver struct is used by EasyLua::forEach to turn the runtime Lua types of a
+         *  key and value pair into a call against the matching visitor overload. Every combination is
+         *  resolved at compile time, so combinations the visitor does not accept are simply skipped.
+         */
+        struct VisitResolver
+        {
+            template <typename visitorType, typename keyType, typename valueType>
+            static INLINE bool invoke(visitorType& visitor, const keyType& key, const valueType& value)
+            {
+                if constexpr (!std::is_invocable<visitorType&, ExactArgument<keyType>, ExactArgument<valueType>>::value ||
+                              !std::is_invocable<visitorType&, const keyType&, const valueType&>::value)
+                    return true;
+                else if constexpr (std::is_same<std::invoke_result_t<visitorType&, const keyType&, const valueType&>, bool>::value)
+                    return visitor(key, value);
+                else
+                {
+                    visitor(key, value);
+                    return true;
+                }
+            }
+
+            template <typename visitorType, typename keyType>
+            static INLINE bool resolveValue(lua_State* lua, visitorType& visitor, const keyType& key)
+            {
+                switch (lua_type(lua, -1))
+                {
+                    case LUA_TNUMBER:
+                    {
+                        if (lua_isinteger(lua, -1))
+                            return invoke(visitor, key, lua_tointeger(lua, -1));
+                        return invoke(visitor, key, lua_tonumber(lua, -1));
+                    }
+
+                    case LUA_TSTRING:
+                    {
+                        size_t length = 0;
+                        const char* value = lua_tolstring(lua, -1, &length);
+                        return invoke(visitor, key, std::string_view(value, length));
+                    }
+
+                    case LUA_TBOOLEAN:
+                        return invoke(visitor, key, lua_toboolean(lua, -1) != 0);
+
+                    case LUA_TTABLE:
+                        return invoke(visitor, key, TableCursor(lua, -1));
+                }
+
+                // Functions, userdata and threads are not visited
+                return true;
+            }
+
+            template <typename visitorType>
+            static INLINE bool resolve(lua_State* lua, visitorType& visitor)
+            {
+                // The key lives at -2. It must never be converted in place, as that would confuse lua_next.
+                switch (lua_type(lua, -2))
+                {
+                    case LUA_TNUMBER:
+                    {
+                        if (lua_isinteger(lua, -2))
+                            return resolveValue(lua, visitor, lua_tointeger(lua, -2));
+                        return resolveValue(lua, visitor, lua_tonumber(lua, -2));
+                    }
+
+                    case LUA_TSTRING:
+                    {
+                        size_t length = 0;
+                        const char* key = lua_tolstring(lua, -2, &length);
+                        return resolveValue(lua, visitor, std::string_view(key, length));
+                    }
+
+                    case LUA_TBOOLEAN:
+                        return resolveValue(lua, visitor, lua_toboolean(lua, -2) != 0);
+                }
+
+                // Table, function and userdata keys are not visited
+                return true;
+            }
+        };
+    }
+
+    /**
+     *  @brief Walks the Lua table at the given stack index using lua_next, calling the visitor
+     *  for every key and value pair without copying anything into C++ containers.
+     *  @param lua A pointer to the lua_State to perform this operation against.
+     *  @param index The stack index of the table to walk.
+     *  @param visitor A callable overloaded on the key and value types it is interested in. Keys are
+     *  passed as lua_Integer, lua_Number, std::string_view or bool. Values may additionally be an
+     *  EasyLua::TableCursor for nested tables. Types must match exactly, so a bool is never passed to a
+     *  lua_Integer overload; combinations the visitor has no overload for are skipped. If an overload
+     *  returns bool, returning false stops the walk.
+     *  @note Generic overloads taking auto parameters are checked against a stand-in type, so those that
+     *  use their arguments must spell out their return type.
+     *  @return True if the entire table was walked, false if the visitor stopped early.
+     *  @note Strings passed as std::string_view are only valid for the duration of the visitor call.
+     *  @throw std::runtime_error Thrown when the value at the given index is not a table or the
+     *  stack cannot be grown.
+     */
+    template <typename visitorType>
+    static INLINE bool forEach(lua_State* lua, const int& index, visitorType&& visitor)
+    {
+        const int table = lua_absindex(lua, index);
+
+        if (lua_type(lua, table) != LUA_TTABLE)
+            throw std::runtime_error("Attempted to walk a value that is not a table!");
+        if (!lua_checkstack(lua, 2))
+            throw std::runtime_error("Unable to grow the Lua stack!");
+
+        lua_pushnil(lua);
+        while (lua_next(lua, table))
+        {
+            const bool keepWalking = EasyLua::Resolvers::VisitResolver::resolve(lua, visitor);
+
+            // Drop the value, keeping the key for the next iteration
+            lua_pop(lua, 1);
+
+            if (!keepWalking)
+            {
+                lua_pop(lua, 1);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template <typename visitorType>
+    bool TableCursor::forEach(visitorType&& visitor) const
+    {
+        return EasyLua::forEach(mLua, mIndex, std::forward<visitorType>(visitor));
+    }
+
+    template <typename visitorType>
+    bool Table::visit(visitorType&& visitor) const
+    {
+        for (auto it = this->begin(); it != this->end(); it++)
+        {
+            const std::string_view& key = it->first;
+            const TableValue& value = it->second;
+
+            bool keepWalking = true;
+            switch (value.type())
+            {
+                case EASYLUA_INTEGER:
+                    keepWalking = EasyLua::Resolvers::VisitResolver::invoke(visitor, key, *value.as<int>());
+                    break;
+
+                case EASYLUA_FLOAT:
+                    keepWalking = EasyLua::Resolvers::VisitResolver::invoke(visitor, key, *value.as<float>());
+                    break;
+
+                case EASYLUA_STRING:
+                    keepWalking = EasyLua::Resolvers::VisitResolver::invoke(visitor, key, std::string_view(*value.as<std::string>()));
+                    break;
+
+                case EASYLUA_TABLE:
+                    keepWalking = EasyLua::Resolvers::VisitResolver::invoke(visitor, key, *value.as<Table>());
+                    break;
+            }
+
+            if (!keepWalking)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     *  @brief Describes the fields of a Lua array of records so that it may be decoded into
+     *  per-field columns by EasyLua::readColumns.
+     *  @param types The C++ type of each column in field order. Any type with a readable
+     *  EasyLua::Converter is supported.
+     */
+    template <typename... types>
+    class ColumnSchema
+    {
+        // Public Members
+        public:
+            //! The type produced by EasyLua::readColumns for this schema: one vector per field.
+            typedef std::tuple<std::vector<types>...> Columns;
+
+            //! The number of fields in this schema.
+            static constexpr size_t size = sizeof...(types);
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting the field names in the same order as the column types.
+             *  @param fieldNames The name of each field. These must outlive the schema.
+             */
+            template <typename... names>
+            ColumnSchema(names... fieldNames) : mNames{{fieldNames...}}
+            {
+                static_assert(sizeof...(names) == sizeof...(types), "One field name is required per column!");
+            }
+
+            //! Returns the name of the field at the given position.
+            const char* name(const size_t& field) const { return mNames[field]; }
+
+        // Private Members
+        private:
+            //! The field names in column order.
+            std::array<const char*, sizeof...(types)> mNames;
+    };
+
+    namespace Resolvers
+    {
+        static const char *COLUMN_EXCEPTION_FORMAT = "Expected %s for field '%s' in row %u! Got type ID %u instead.";
+
+        /**
+         *  @brief The ColumnReadResolver template struct is used by EasyLua::readColumns to append the
+         *  value at the top of the stack to a column of the given type through its EasyLua::Converter.
+         *  Nil values produce a default constructed entry so that all columns stay the same length.
+         */
+        template <typename type>
+        struct ColumnReadResolver
+        {
+            static INLINE void resolve(lua_State* lua, std::vector<type>& column, const char* field, const size_t& row)
+            {
+                const int luaType = lua_type(lua, -1);
+
+                if (luaType == LUA_TNIL)
+                {
+                    column.emplace_back();
+                    return;
+                }
+
+                if (EasyLua::Converter<type>::check(lua, -1))
+                {
+                    column.push_back(EasyLua::Converter<type>::read(lua, -1));
+                    return;
+                }
+
+                char error[256];
+                snprintf(error, sizeof(error), COLUMN_EXCEPTION_FORMAT, EasyLua::Converter<type>::name, field, static_cast<unsigned int>(row), luaType);
+
+                throw std::runtime_error(error);
+            }
+        };
+
+        template <typename... types, size_t... fields>
+        static INLINE void resolveColumnRow(lua_State* lua, const ColumnSchema<types...>& schema, typename ColumnSchema<types...>::Columns& columns,
+                                            const int& keys, const int& record, const size_t& row, std::index_sequence<fields...>)
+        {
+            // The keys were interned onto the stack once, so each lookup is a plain rawget
+            ((lua_pushvalue(lua, keys + static_cast<int>(fields)),
+              lua_rawget(lua, record),
+              ColumnReadResolver<types>::resolve(lua, std::get<fields>(columns), schema.name(fields), row),
+              lua_pop(lua, 1)), ...);
+        }
+    }
+
+    /**
+     *  @brief Decodes a Lua array of records, such as { { id = 1, x = 2 }, { id = 3, x = 4 } }, into one
+     *  contiguous std::vector per field in a single pass.
+     *  @param lua A pointer to the lua_State to perform this operation against.
+     *  @param index The stack index of the array to decode.
+     *  @param schema The fields to decode and their C++ types.
+     *  @return A tuple holding one column per schema field, each lua_rawlen entries long.
+     *  @throw std::runtime_error Thrown when the value at the given index or any of its elements is not a
+     *  table, or when a field holds a value of the wrong type. The stack is restored before throwing.
+     */
+    template <typename... types>
+    static INLINE typename ColumnSchema<types...>::Columns readColumns(lua_State* lua, const int& index, const ColumnSchema<types...>& schema)
+    {
+        EasyLua::StackGuard guard(lua);
+        const int table = lua_absindex(lua, index);
+
+        if (lua_type(lua, table) != LUA_TTABLE)
+            throw std::runtime_error("Attempted to read columns from a value that is not a table!");
+        if (!lua_checkstack(lua, static_cast<int>(sizeof...(types)) + 2))
+            throw std::runtime_error("Unable to grow the Lua stack!");
+
+        const size_t rows = lua_rawlen(lua, table);
+
+        typename ColumnSchema<types...>::Columns columns;
+        std::apply([rows](auto&... column) { (column.reserve(rows), ...); }, columns);
+
+        // Intern the field names once for the entire read
+        const int keys = guard.top() + 1;
+        for (size_t field = 0; field < sizeof...(types); ++field)
+            lua_pushstring(lua, schema.name(field));
+
+        const int record = keys + static_cast<int>(sizeof...(types));
+
+        for (size_t row = 1; row <= rows; ++row)
+        {
+            if (lua_rawgeti(lua, table, static_cast<lua_Integer>(row)) != LUA_TTABLE)
+            {
+                char error[256];
+                snprintf(error, sizeof(error), "Expected a table for row %u!", static_cast<unsigned int>(row));
+
+                throw std::runtime_error(error);
+            }
+
+            EasyLua::Resolvers::resolveColumnRow(lua, schema, columns, keys, record, row, std::index_sequence_for<types...>());
+            lua_pop(lua, 1);
+        }
+
+        return columns;
+    }
+
+    namespace Resolvers
+    {
+        /**
+         *  @brief The hook through which EasyLua::call and EasyLua::pcall feed an attached EasyLua::Recorder.
+         *  While no recorder is attached anywhere, calls only pay for one relaxed atomic load. Defined in
+         *  easylua_recorder.cpp.
+         */
+        struct CallRecording
+        {
+            //! The number of recorders attached across all states.
+            static std::atomic<unsigned int> sActive;
+
+            //! Returns whether any recorder is attached.
+            static INLINE bool isActive(void) { return sActive.load(std::memory_order_relaxed) != 0; }
+
+            /**
+             *  @brief Calls the function below the parameters on the stack like lua_call or lua_pcall, recording the
+             *  call if a recorder is attached to the state.
+             *  @param lua A pointer to the lua_State to use for this operation.
+             *  @param methodName The name of the function being called.
+             *  @param parameterCount The number of parameters pushed after the function.
+             *  @param errorHandler The error handler index as passed to lua_pcall.
+             *  @param protect Whether the call is protected. Errors of unprotected calls are raised again after
+             *  they were recorded.
+             *  @return The status of the call.
+             */
+            static int invoke(lua_State* lua, const char* methodName, const int& parameterCount, const int& errorHandler, const bool& protect);
+        };
+    }
+
     /**
      *  @brief Performs an unprotected Lua call.
      *  @param lua A pointer to the lua_State to perform this operation against.
@@ -896,24 +2070,40 @@ namespace EasyLua
     {
         const int oldTop = lua_gettop(lua);
 
+        EasyLua::Utilities::reserveStack<static_cast<int>(sizeof...(params)) + 1>(lua);
         lua_getglobal(lua, methodName);
-        EasyLua::Utilities::pushParameters(lua, params...);
+        EasyLua::Utilities::pushReserved(lua, params...);
 
-        lua_call(lua, sizeof...(params), LUA_MULTRET);
+        if (EasyLua::Resolvers::CallRecording::isActive())
+            EasyLua::Resolvers::CallRecording::invoke(lua, methodName, sizeof...(params), 0, false);
+        else
+            lua_call(lua, sizeof...(params), LUA_MULTRET);
 
         return abs(lua_gettop(lua) - oldTop);
     }
 
+    /**
+     *  @brief Performs an unprotected Lua call with parameters that were already pushed.
+     *  @param lua A pointer to the lua_State to perform this operation against.
+     *  @param methodName A string representing the name of the global method in the Lua runtime to call.
+     *  @param parameterCount The number of parameters on top of the stack. The function is inserted below them.
+     *  @return The number of values returned.
+     */
     static INLINE unsigned int call(lua_State* lua, const char* methodName, const EasyLua::ParameterCount& parameterCount)
     {
-        const int stackTop = lua_gettop(lua);
+        const int count = static_cast<int>(parameterCount);
+        const int base = lua_gettop(lua) - count;
 
+        EasyLua::Utilities::reserveStack<1>(lua);
         lua_getglobal(lua, methodName);
-        lua_insert(lua, 1);
+        lua_insert(lua, -(count + 1));
 
-        lua_call(lua, parameterCount, LUA_MULTRET);
+        if (EasyLua::Resolvers::CallRecording::isActive())
+            EasyLua::Resolvers::CallRecording::invoke(lua, methodName, count, 0, false);
+        else
+            lua_call(lua, count, LUA_MULTRET);
 
-        return lua_gettop(lua) - stackTop;
+        return lua_gettop(lua) - base;
     }
 
     template <typename... parameters>
@@ -921,40 +2111,83 @@ namespace EasyLua
     {
         const int stackTop = lua_gettop(lua);
 
+        EasyLua::Utilities::reserveStack<static_cast<int>(sizeof...(params)) + 1>(lua);
         lua_getglobal(lua, methodName);
-        EasyLua::Utilities::pushParameters(lua, params...);
+        EasyLua::Utilities::pushReserved(lua, params...);
 
-        return std::make_pair(lua_pcall(lua, sizeof...(params), LUA_MULTRET, 0), lua_gettop(lua) - stackTop);
+        const int status = EasyLua::Resolvers::CallRecording::isActive() ? EasyLua::Resolvers::CallRecording::invoke(lua, methodName, sizeof...(params), 0, true)
+                                                                         : lua_pcall(lua, sizeof...(params), LUA_MULTRET, 0);
+        return std::make_pair(status, lua_gettop(lua) - stackTop);
     }
 
+    /**
+     *  @brief Performs a protected Lua call with parameters that were already pushed.
+     *  @param lua A pointer to the lua_State to perform this operation against.
+     *  @param methodName A string representing the name of the global method in the Lua runtime to call.
+     *  @param parameterCount The number of parameters on top of the stack. The function is inserted below them.
+     *  @return The status and the number of values returned.
+     */
     static INLINE std::pair<int, size_t> pcall(lua_State* lua, const char* methodName, const EasyLua::ParameterCount& parameterCount)
     {
-        const int stackTop = lua_gettop(lua);
+        const int count = static_cast<int>(parameterCount);
+        const int base = lua_gettop(lua) - count;
 
+        EasyLua::Utilities::reserveStack<1>(lua);
         lua_getglobal(lua, methodName);
-        return std::make_pair(lua_pcall(lua, parameterCount, LUA_MULTRET, 0), lua_gettop(lua) - stackTop);
+        lua_insert(lua, -(count + 1));
+
+        const int status = EasyLua::Resolvers::CallRecording::isActive() ? EasyLua::Resolvers::CallRecording::invoke(lua, methodName, count, 0, true)
+                                                                         : lua_pcall(lua, count, LUA_MULTRET, 0);
+        return std::make_pair(status, lua_gettop(lua) - base);
     }
 
+    /**
+     *  @brief Performs a protected Lua call with an error handler and parameters that were already pushed.
+     *  @param lua A pointer to the lua_State to perform this operation against.
+     *  @param methodName A string representing the name of the global method in the Lua runtime to call.
+     *  @param errorHandler The name of the global function handling errors.
+     *  @param parameterCount The number of parameters on top of the stack. The error handler and the function
+     *  are inserted below them.
+     *  @return The status and the number of values left on the stack, which includes the error handler below
+     *  the results.
+     */
     static INLINE std::pair<int, size_t> pcall(lua_State* lua, const char* methodName, const char* errorHandler, const EasyLua::ParameterCount& parameterCount)
     {
-        const int stackTop = lua_gettop(lua);
+        const int count = static_cast<int>(parameterCount);
+        const int base = lua_gettop(lua) - count;
 
+        EasyLua::Utilities::reserveStack<2>(lua);
         lua_getglobal(lua, errorHandler);
+        lua_insert(lua, -(count + 1));
         lua_getglobal(lua, methodName);
+        lua_insert(lua, -(count + 1));
 
-        return std::make_pair(lua_pcall(lua, parameterCount, LUA_MULTRET, -2), lua_gettop(lua) - stackTop);
+        const int status = EasyLua::Resolvers::CallRecording::isActive() ? EasyLua::Resolvers::CallRecording::invoke(lua, methodName, count, base + 1, true)
+                                                                         : lua_pcall(lua, count, LUA_MULTRET, base + 1);
+        return std::make_pair(status, lua_gettop(lua) - base);
     }
 
+    /**
+     *  @brief Performs a protected Lua call with an error handler.
+     *  @param lua A pointer to the lua_State to perform this operation against.
+     *  @param methodName A string representing the name of the global method in the Lua runtime to call.
+     *  @param errorHandler The name of the global function handling errors.
+     *  @return The status and the number of values left on the stack, which includes the error handler below
+     *  the results.
+     */
     template <typename... parameters>
     static INLINE std::pair<int, size_t> pcall(lua_State* lua, const char* methodName, const char* errorHandler, parameters... params)
     {
         const int stackTop = lua_gettop(lua);
 
+        EasyLua::Utilities::reserveStack<static_cast<int>(sizeof...(params)) + 2>(lua);
         lua_getglobal(lua, errorHandler);
         lua_getglobal(lua, methodName);
-        EasyLua::Utilities::pushParameters(lua, params...);
+        EasyLua::Utilities::pushReserved(lua, params...);
 
-        return std::make_pair(lua_pcall(lua, sizeof...(params), LUA_MULTRET, sizeof...(params) - 2), lua_gettop(lua) - stackTop);
+        const int status = EasyLua::Resolvers::CallRecording::isActive() ? EasyLua::Resolvers::CallRecording::invoke(lua, methodName, sizeof...(params), stackTop + 1, true)
+                                                                         : lua_pcall(lua, sizeof...(params), LUA_MULTRET, stackTop + 1);
+        return std::make_pair(status, lua_gettop(lua) - stackTop);
     } // End "NameSpace" Utilities
 } // End NameSpace EasyLua
 
@@ -0,0 +1,198 @@
+/**
+ *  @file easylua_arrays.hpp
+ *  @brief Include file declaring typed array userdata and their vectorized kernels.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_ARRAYS_HPP_
+#define _INCLUDE_EASYLUA_ARRAYS_HPP_
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief A contiguous buffer of float32, float64 or int32 elements living in a Lua userdata. The buffer
+     *  is either owned by the userdata or borrowed from C++, in which case scripts operate on the C++ memory
+     *  directly without any copying.
+     *
+     *  Scripts index arrays from 1, query the length with # and call vectorized kernels as methods: sum, min,
+     *  max, dot(other), axpy(alpha, x) computing self = alpha * x + self, scale(factor), clamp(low, high) and
+     *  prefixSum. The kernels run as AVX2 or SSE2 loops where the CPU supports them, falling back to scalar
+     *  loops elsewhere. Sums and dot products of int32 arrays are accumulated as 64 bit integers.
+     *  @note Calling open registers the constructors TypedArray.float32, TypedArray.float64 and TypedArray.int32,
+     *  each accepting either a length or a table of numbers to copy.
+     */
+    class TypedArray
+    {
+        // Public Members
+        public:
+            //! The element types a typed array may hold.
+            enum Type
+            {
+                //! 32 bit floating point elements.
+                FLOAT32 = 0,
+                //! 64 bit floating point elements.
+                FLOAT64 = 1,
+                //! 32 bit signed integer elements.
+                INT32 = 2,
+            };
+
+            //! The instruction sets the kernels are available for.
+            enum KernelLevel
+            {
+                //! Plain loops.
+                KERNELS_SCALAR = 0,
+                //! SSE2 loops for float32 and float64. int32 arrays use plain loops.
+                KERNELS_SSE2 = 1,
+                //! AVX2 loops for all element types.
+                KERNELS_AVX2 = 2,
+            };
+
+            //! The registry name of the typed array metatable.
+            static constexpr const char* METATABLE = "EasyLua.TypedArray";
+
+        // Private Members
+        private:
+            //! The elements.
+            void* mData;
+            //! The number of elements.
+            size_t mLength;
+            //! The element type.
+            Type mType;
+            //! Whether the elements live in the userdata itself.
+            bool mOwned;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Constructor. Typed arrays only ever live inside Lua userdata.
+             *  @param data The elements.
+             *  @param length The number of elements.
+             *  @param type The element type.
+             *  @param owned Whether the elements live in the userdata itself.
+             */
+            TypedArray(void* data, const size_t& length, const Type& type, const bool& owned) : mData(data), mLength(length), mType(type), mOwned(owned) { }
+
+            /**
+             *  @brief Pushes a new typed array userdata.
+             *  @param lua The state to push to.
+             *  @param type The element type.
+             *  @param length The number of elements.
+             *  @param data The borrowed elements, or nullptr to allocate zeroed elements inside the userdata.
+             *  @return The new typed array.
+             */
+            static TypedArray* allocate(lua_State* lua, const Type& type, const size_t& length, void* data);
+
+        // Public Methods
+        public:
+            TypedArray(const TypedArray& other) = delete;
+            TypedArray& operator=(const TypedArray& other) = delete;
+
+            /**
+             *  @brief Registers the global TypedArray table holding the typed array constructors.
+             *  @param lua The state to register with.
+             */
+            static void open(lua_State* lua);
+
+            /**
+             *  @brief Pushes a new typed array owning zeroed elements.
+             *  @param lua The state to push to.
+             *  @param type The element type.
+             *  @param length The number of elements.
+             *  @return The new typed array, valid for as long as the userdata is alive.
+             */
+            static TypedArray* create(lua_State* lua, const Type& type, const size_t& length);
+
+            /**
+             *  @brief Pushes a new typed array over elements owned by C++. No elements are copied.
+             *  @param lua The state to push to.
+             *  @param data The elements.
+             *  @param length The number of elements.
+             *  @return The new typed array, valid for as long as the userdata is alive.
+             *  @warning The elements must outlive every use from Lua. Call detach before freeing them if scripts
+             *  may still hold the array.
+             */
+            static TypedArray* borrow(lua_State* lua, float* data, const size_t& length);
+            static TypedArray* borrow(lua_State* lua, double* data, const size_t& length);
+            static TypedArray* borrow(lua_State* lua, int32_t* data, const size_t& length);
+
+            /**
+             *  @brief Returns the typed array at the given stack index.
+             *  @param lua The state to read from.
+             *  @param index The stack index to read.
+             *  @return The typed array, or nullptr if the value is not a typed array.
+             */
+            static TypedArray* get(lua_State* lua, const int& index);
+
+            //! Returns the instruction set the kernels currently run with.
+            static KernelLevel kernels(void);
+
+            /**
+             *  @brief Restricts the kernels to the given instruction set, or the best supported one below it. This
+             *  is meant for testing and benchmarking the fallbacks.
+             *  @param level The highest instruction set to use.
+             *  @return The instruction set now in use.
+             *  @warning This must not be called while kernels may be running on other threads.
+             */
+            static KernelLevel useKernels(const KernelLevel& level);
+
+            //! Returns the element type.
+            Type type(void) const { return mType; }
+
+            //! Returns the number of elements.
+            size_t length(void) const { return mLength; }
+
+            //! Returns whether the elements live in the userdata rather than being borrowed.
+            bool isOwned(void) const { return mOwned; }
+
+            /**
+             *  @brief Returns the elements.
+             *  @param scalar The element type to access the elements as: float, double or int32_t.
+             *  @throw std::runtime_error Thrown when the element type does not match.
+             */
+            template <typename scalar>
+            scalar* data(void)
+            {
+                static_assert(std::is_same<scalar, float>::value || std::is_same<scalar, double>::value || std::is_same<scalar, int32_t>::value,
+                              "Typed arrays hold float, double or int32_t elements!");
+
+                constexpr Type expected = std::is_same<scalar, float>::value ? FLOAT32 : (std::is_same<scalar, double>::value ? FLOAT64 : INT32);
+
+                if (mType != expected)
+                    throw std::runtime_error("Mismatched typed array element type!");
+
+                return reinterpret_cast<scalar*>(mData);
+            }
+
+            /**
+             *  @brief Detaches a borrowed array from its elements, leaving it empty. Scripts still holding the array
+             *  then see zero elements rather than freed memory.
+             *  @throw std::runtime_error Thrown when the array owns its elements.
+             */
+            void detach(void);
+    };
+
+    //! Typed arrays may be read with readStack and friends. They are created with TypedArray::create or borrow.
+    template <>
+    struct Converter<TypedArray*>
+    {
+        static constexpr const char* name = "typed array";
+
+        static INLINE bool check(lua_State* lua, const int& index) { return TypedArray::get(lua, index) != nullptr; }
+
+        static INLINE TypedArray* read(lua_State* lua, const int& index) { return TypedArray::get(lua, index); }
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_ARRAYS_HPP_
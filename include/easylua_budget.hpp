@@ -0,0 +1,189 @@
+/**
+ *  @file easylua_budget.hpp
+ *  @brief Include file declaring calls bounded by an instruction or time budget.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_BUDGET_HPP_
+#define _INCLUDE_EASYLUA_BUDGET_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    //! The status returned by budgeted pcalls when the budget ran out. Distinct from every LUA_* status.
+    static constexpr int EASYLUA_ERRBUDGET = 64;
+
+    /**
+     *  @brief Limits how long a call may run, by instruction count, wall clock time or both. Enforced
+     *  by a count hook that checks the budget every granularity instructions, so a call may overrun
+     *  by up to that many instructions.
+     *  @note A budget measures one call or one resume at a time; it starts over each time it is used.
+     *  @warning Scripts that catch errors with their own pcall in an endless loop can still run past
+     *  an aborting budget, as every check raises the error again inside that pcall.
+     */
+    class Budget
+    {
+        // Public Members
+        public:
+            //! What happens when the budget runs out.
+            enum Mode
+            {
+                //! The call is aborted with EASYLUA_ERRBUDGET.
+                ABORT = 0,
+                //! The running coroutine yields so it can be resumed later. Falls back to ABORT when not yieldable.
+                YIELD = 1,
+            };
+
+            //! The number of instructions allowed. 0 means unlimited.
+            uint64_t instructions;
+
+            //! The wall clock time allowed. 0 means unlimited.
+            std::chrono::nanoseconds time;
+
+            //! What happens when the budget runs out.
+            Mode mode;
+
+            //! How many instructions run between checks.
+            int granularity;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param instructions The number of instructions allowed. 0 means unlimited.
+             *  @param time The wall clock time allowed. 0 means unlimited.
+             *  @param mode What happens when the budget runs out.
+             *  @param granularity How many instructions run between checks.
+             */
+            Budget(const uint64_t& instructions, const std::chrono::nanoseconds& time = std::chrono::nanoseconds::zero(), const Mode& mode = ABORT,
+            const int& granularity = 1000) : instructions(instructions), time(time), mode(mode), granularity(granularity), mUsed(0), mExhausted(false) { }
+
+            //! Returns whether the budget ran out during its last use.
+            bool exhausted(void) const { return mExhausted; }
+
+            //! Returns roughly how many instructions ran during its last use.
+            uint64_t used(void) const { return mUsed; }
+
+            /**
+             *  @brief Installs the budget on the given state or coroutine until the matching uninstall. Used by
+             *  the budgeted call, pcall and resume, but available for custom call sequences.
+             *  @param lua The state or coroutine to limit.
+             */
+            void install(lua_State* lua);
+
+            /**
+             *  @brief Removes the budget from the given state or coroutine and restores whatever hook was set
+             *  before.
+             *  @param lua The state or coroutine the budget was installed on.
+             */
+            void uninstall(lua_State* lua);
+
+        // Private Methods
+        private:
+            //! The count hook enforcing budgets.
+            static void hook(lua_State* lua, lua_Debug* debug);
+
+        // Private Members
+        private:
+            //! The instructions counted so far.
+            uint64_t mUsed;
+            //! When the time budget runs out.
+            std::chrono::steady_clock::time_point mDeadline;
+            //! Whether the budget ran out.
+            bool mExhausted;
+            //! The hook that was installed before.
+            lua_Hook mPreviousHook;
+            //! The mask of the hook that was installed before.
+            int mPreviousMask;
+            //! The count of the hook that was installed before.
+            int mPreviousCount;
+    };
+
+    /**
+     *  @brief Thrown by budgeted calls when the budget ran out.
+     */
+    class BudgetExceeded : public std::runtime_error
+    {
+        public:
+            BudgetExceeded(void) : std::runtime_error("Budget exceeded!") { }
+    };
+
+    /**
+     *  @brief Performs a protected call of the function below the given number of parameters on the stack,
+     *  bounded by a budget.
+     *  @param lua A pointer to the lua_State to use for this operation.
+     *  @param budget The budget to enforce.
+     *  @param parameterCount The number of parameters pushed after the function.
+     *  @return The status, which is EASYLUA_ERRBUDGET with an error message on the stack when the budget
+     *  ran out, and the number of values returned.
+     */
+    std::pair<int, size_t> pcall(lua_State* lua, Budget& budget, const EasyLua::ParameterCount& parameterCount);
+
+    /**
+     *  @brief Resumes a coroutine bounded by a budget. With a YIELD budget, a coroutine that runs out
+     *  yields with no values and the budget reports exhausted, telling it apart from yields of the script.
+     *  @param thread The coroutine to resume.
+     *  @param from The state resuming it, or nullptr.
+     *  @param budget The budget to enforce.
+     *  @param parameterCount The number of parameters on the stack of the coroutine.
+     *  @return The status of lua_resume, or EASYLUA_ERRBUDGET when an ABORT budget ran out, and the number
+     *  of values returned or yielded.
+     */
+    std::pair<int, int> resume(lua_State* thread, lua_State* from, Budget& budget, const EasyLua::ParameterCount& parameterCount);
+
+    /**
+     *  @brief Performs a protected call of a global function bounded by a budget.
+     *  @param lua A pointer to the lua_State to use for this operation.
+     *  @param budget The budget to enforce.
+     *  @param methodName The name of the global function to call.
+     *  @param params The parameters to pass.
+     *  @return The status, which is EASYLUA_ERRBUDGET when the budget ran out, and the number of values returned.
+     */
+    template <typename... parameters>
+    static INLINE std::pair<int, size_t> pcall(lua_State* lua, Budget& budget, const char* methodName, parameters... params)
+    {
+        lua_getglobal(lua, methodName);
+        EasyLua::Utilities::pushParameters(lua, params...);
+
+        return EasyLua::pcall(lua, budget, static_cast<EasyLua::ParameterCount>(sizeof...(params)));
+    }
+
+    /**
+     *  @brief Calls a global function bounded by a budget. Errors raised by the function propagate as with
+     *  an unprotected call.
+     *  @param lua A pointer to the lua_State to use for this operation.
+     *  @param budget The budget to enforce.
+     *  @param methodName The name of the global function to call.
+     *  @param params The parameters to pass.
+     *  @return The number of values returned.
+     *  @throw EasyLua::BudgetExceeded Thrown when the budget ran out.
+     */
+    template <typename... parameters>
+    static INLINE size_t call(lua_State* lua, Budget& budget, const char* methodName, parameters... params)
+    {
+        const std::pair<int, size_t> result = EasyLua::pcall(lua, budget, methodName, params...);
+
+        if (result.first == EASYLUA_ERRBUDGET)
+        {
+            lua_pop(lua, 1);
+            throw BudgetExceeded();
+        }
+        else if (result.first != LUA_OK)
+            lua_error(lua);
+
+        return result.second;
+    }
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_BUDGET_HPP_
@@ -0,0 +1,115 @@
+/**
+ *  @file easylua_codec.hpp
+ *  @brief Include file declaring the compact binary encoding of Lua values.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_CODEC_HPP_
+#define _INCLUDE_EASYLUA_CODEC_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Encodes Lua values from the stack into a compact binary form and pushes them back. Every value
+     *  starts with a one byte tag. Integers and numbers follow as 8 bytes and strings as a 32-bit length and
+     *  the bytes, all in host byte order. Tables follow as a 32-bit entry count and their keys and values.
+     *
+     *  The entries of a table are sorted by their encoded key, so equal tables always encode to the same bytes
+     *  regardless of the order Lua iterates them in. This makes encodings usable as lookup keys.
+     *  @note Functions, userdata and threads cannot be encoded. They are written as opaque values that decode
+     *  to nil, and encode reports that the encoding is incomplete.
+     */
+    class ValueCodec
+    {
+        // Public Members
+        public:
+            //! The tag starting every encoded value.
+            enum Tag
+            {
+                TAG_NIL = 0,
+                TAG_FALSE = 1,
+                TAG_TRUE = 2,
+                TAG_INTEGER = 3,
+                TAG_NUMBER = 4,
+                TAG_STRING = 5,
+                TAG_TABLE = 6,
+                //! A value that could not be encoded.
+                TAG_OPAQUE = 7,
+            };
+
+            //! Tables nested deeper than this are encoded as opaque values, which also breaks reference cycles.
+            static constexpr int MAXIMUM_DEPTH = 32;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Appends the encoding of a single value.
+             *  @param lua The state to read from.
+             *  @param index The stack index of the value.
+             *  @param out The buffer to append to.
+             *  @return False if any part of the value had to be encoded as opaque.
+             */
+            static bool encode(lua_State* lua, const int& index, std::string& out);
+
+            /**
+             *  @brief Appends the encodings of consecutive values.
+             *  @param lua The state to read from.
+             *  @param first The stack index of the first value.
+             *  @param count The number of values.
+             *  @param out The buffer to append to.
+             *  @return False if any part of any value had to be encoded as opaque.
+             */
+            static bool encode(lua_State* lua, const int& first, const int& count, std::string& out);
+
+            /**
+             *  @brief Pushes a single encoded value.
+             *  @param lua The state to push to.
+             *  @param begin The start of the encoded value.
+             *  @param end The end of the buffer holding it.
+             *  @return The position right after the encoded value.
+             *  @throw std::runtime_error Thrown when the encoding is malformed. Nothing is left on the stack.
+             */
+            static const char* decode(lua_State* lua, const char* begin, const char* end);
+
+            /**
+             *  @brief Pushes every value of an encoding.
+             *  @param lua The state to push to.
+             *  @param data The encoded values.
+             *  @return The number of values pushed.
+             *  @throw std::runtime_error Thrown when the encoding is malformed. Nothing is left on the stack.
+             */
+            static int decode(lua_State* lua, const std::string& data);
+
+            /**
+             *  @brief Appends the raw bytes of a value in host byte order.
+             *  @param out The buffer to append to.
+             *  @param value The value to append.
+             */
+            template <typename type>
+            static void writeRaw(std::string& out, const type& value)
+            {
+                out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+
+        // Private Methods
+        private:
+            //! Appends the encoding of a single value at the given nesting depth.
+            static bool encodeValue(lua_State* lua, const int& index, std::string& out, const int& depth);
+
+            //! Pushes a single encoded value at the given nesting depth.
+            static const char* decodeValue(lua_State* lua, const char* begin, const char* end, const int& depth);
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_CODEC_HPP_
@@ -0,0 +1,284 @@
+/**
+ *  @file easylua_concurrent.hpp
+ *  @brief Include file declaring a Table variant for concurrent readers and writers.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_CONCURRENT_HPP_
+#define _INCLUDE_EASYLUA_CONCURRENT_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <easylua.hpp>
+#include <easylua_epoch.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief A string keyed table that may be read and written from any number of threads at once.
+     *
+     *  Keys are spread over shards, each holding an array of buckets that are copied on write. A writer
+     *  locks only the shard it modifies, copies the one bucket holding the key and publishes it with a
+     *  single atomic store, so writers to different shards share nothing and a write costs the size of
+     *  one bucket rather than the shard. Shards double their bucket arrays as they fill. Readers never
+     *  lock; they load immutable buckets, with replaced buckets reclaimed through an EasyLua::EpochDomain.
+     *
+     *  push and copy work from a point in time: they briefly take every shard lock to capture the current
+     *  buckets, then read them without holding any lock.
+     */
+    class ConcurrentTable
+    {
+        // Public Members
+        public:
+            /**
+             *  @brief A reader slot. Every thread reading the table needs its own.
+             */
+            class Reader
+            {
+                friend class ConcurrentTable;
+
+                // Private Members
+                private:
+                    //! The table being read.
+                    ConcurrentTable& mTable;
+                    //! The epoch slot in use.
+                    EpochDomain::Reader* mSlot;
+
+                // Public Methods
+                public:
+                    /**
+                     *  @brief Constructor registering a reader slot.
+                     *  @param table The table to read.
+                     */
+                    Reader(ConcurrentTable& table) : mTable(table), mSlot(table.mEpochs.registerReader()) { }
+
+                    //! Standard destructor returning the reader slot.
+                    ~Reader(void) { mTable.mEpochs.unregisterReader(mSlot); }
+
+                    Reader(const Reader& other) = delete;
+                    Reader& operator=(const Reader& other) = delete;
+            };
+
+        // Private Members
+        private:
+            struct Node;
+
+            //! An immutable stored value.
+            struct Value
+            {
+                //! The EasyLua type ID.
+                unsigned char type;
+                //! The value when type is EASYLUA_INTEGER.
+                int integer;
+                //! The value when type is EASYLUA_FLOAT.
+                float number;
+                //! The value when type is EASYLUA_STRING.
+                std::string string;
+                //! The value when type is EASYLUA_TABLE.
+                std::shared_ptr<const Node> table;
+            };
+
+            //! An immutable copy of a subtable.
+            struct Node
+            {
+                //! The entries of the subtable.
+                std::vector<std::pair<std::string, Value>> entries;
+            };
+
+            //! An immutable chain of the entries whose keys hash into the same bucket.
+            struct Bucket
+            {
+                //! The entries of the bucket.
+                std::vector<std::pair<std::string, Value>> entries;
+            };
+
+            //! The buckets of a shard. Only the array itself is replaced when the shard grows.
+            struct Buckets
+            {
+                //! The current version of every bucket, or nullptr while empty.
+                std::vector<std::atomic<const Bucket*>> slots;
+
+                /**
+                 *  @brief Constructor.
+                 *  @param size The number of buckets.
+                 */
+                Buckets(const size_t& size);
+            };
+
+            //! A shard of the table with its own writer lock.
+            struct Shard
+            {
+                //! Held by writers of this shard and briefly by point in time captures.
+                std::mutex lock;
+                //! The current bucket array.
+                std::atomic<Buckets*> buckets;
+                //! The number of entries.
+                std::atomic<size_t> count;
+                //! Replaced buckets not yet handed to the epoch domain, guarded by lock.
+                std::vector<const Bucket*> retiredBuckets;
+                //! Replaced bucket arrays not yet handed to the epoch domain, guarded by lock.
+                std::vector<const Buckets*> retiredArrays;
+            };
+
+            //! The shards.
+            std::unique_ptr<Shard[]> mShards;
+
+            //! The number of shards.
+            size_t mShardCount;
+
+            //! Reclamation of replaced buckets.
+            EpochDomain mEpochs;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Replaces the value of a key, or removes it.
+             *  @param key The key to write.
+             *  @param value The value to store, or nullptr to remove the key.
+             */
+            void write(const std::string& key, const Value* value);
+
+            /**
+             *  @brief Doubles the bucket array of a shard. The caller holds the shard lock.
+             *  @param shard The shard to grow.
+             */
+            void grow(Shard& shard);
+
+            /**
+             *  @brief Returns the bucket a key belongs in within an array of buckets.
+             *  @param hash The hash of the key.
+             *  @param buckets The bucket array.
+             */
+            size_t bucket(const size_t& hash, const Buckets& buckets) const { return (hash / mShardCount) & (buckets.slots.size() - 1); }
+
+            /**
+             *  @brief Looks up a key. The caller holds an epoch guard.
+             *  @param key The key to look up.
+             *  @return The value, or nullptr if there is no such key.
+             */
+            const Value* lookup(const std::string& key) const;
+
+            /**
+             *  @brief Looks up a key and checks its type. The caller holds an epoch guard.
+             *  @param key The key to look up.
+             *  @param type The EasyLua type ID expected.
+             *  @throw std::runtime_error Thrown when there is a type mismatch.
+             *  @throw std::out_of_range Thrown when the requested key does not exist.
+             */
+            const Value& find(const std::string& key, const unsigned char& type) const;
+
+            /**
+             *  @brief Captures the buckets of every shard at a single point in time. The caller holds an epoch
+             *  guard, which keeps the captured buckets alive.
+             *  @param count Set to the number of entries across the captured buckets.
+             *  @return The non-empty buckets.
+             */
+            std::vector<const Bucket*> capture(size_t& count);
+
+            //! Converts a Table into an immutable node.
+            static std::shared_ptr<const Node> freezeTable(Table& table);
+
+            //! Converts an immutable node back into a Table.
+            static void thawTable(const Node& node, Table& out);
+
+            //! Pushes a stored value to the Lua stack.
+            static void pushValue(lua_State* lua, const Value& value);
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param shards The number of shards. More shards make writers less contended.
+             */
+            ConcurrentTable(const size_t& shards = 64);
+
+            //! Standard destructor. No reader or writer may be active.
+            ~ConcurrentTable(void);
+
+            ConcurrentTable(const ConcurrentTable& other) = delete;
+            ConcurrentTable& operator=(const ConcurrentTable& other) = delete;
+
+            /**
+             *  @brief Sets the property in the table.
+             *  @param key The name of the property to write to.
+             *  @param value The value to write.
+             */
+            void set(const std::string& key, const int& value);
+            void set(const std::string& key, const float& value);
+            void set(const std::string& key, const std::string& value);
+            void set(const std::string& key, const char* value) { this->set(key, std::string(value)); }
+
+            /**
+             *  @brief Stores an immutable deep copy of a table on the given property name.
+             *  @param key The name of the property to write to.
+             *  @param value The table to copy.
+             */
+            void set(const std::string& key, Table& value);
+
+            /**
+             *  @brief Removes the property from the table if present.
+             *  @param key The name of the property to remove.
+             */
+            void remove(const std::string& key);
+
+            /**
+             *  @brief Reads the property in the table without taking any lock.
+             *  @param reader The reader slot of the calling thread.
+             *  @param key The name of the property to read.
+             *  @param out The reference to read out to. Subtables are read out as deep copies.
+             *  @throw std::runtime_error Thrown when there is a type mismatch.
+             *  @throw std::out_of_range Thrown when the requested key does not exist.
+             */
+            void get(Reader& reader, const std::string& key, int& out);
+            void get(Reader& reader, const std::string& key, float& out);
+            void get(Reader& reader, const std::string& key, std::string& out);
+            void get(Reader& reader, const std::string& key, Table& out);
+
+            /**
+             *  @brief Returns whether the property exists.
+             *  @param reader The reader slot of the calling thread.
+             *  @param key The name of the property to look up.
+             */
+            bool contains(Reader& reader, const std::string& key);
+
+            /**
+             *  @brief Returns the number of entries.
+             *  @param reader The reader slot of the calling thread.
+             *  @note While writes are in flight, shards may be counted at slightly different points in time.
+             */
+            size_t size(Reader& reader);
+
+            /**
+             *  @brief Pushes a Lua table with the contents of this table as of a single point in time.
+             *  @param reader The reader slot of the calling thread.
+             *  @param lua The Lua state to push the table to.
+             */
+            void push(Reader& reader, lua_State* lua);
+
+            /**
+             *  @brief Copies the contents of this table as of a single point in time into a Table.
+             *  @param reader The reader slot of the calling thread.
+             *  @param out The table to copy into. Its previous contents are cleared.
+             */
+            void copy(Reader& reader, Table& out);
+
+            /**
+             *  @brief Frees replaced buckets no reader can still observe. Writes do this periodically.
+             *  @return The number of batches of replaced buckets still pending.
+             */
+            size_t reclaim(void) { return mEpochs.reclaim(); }
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_CONCURRENT_HPP_
@@ -0,0 +1,170 @@
+/**
+ *  @file easylua_epoch.hpp
+ *  @brief Include file declaring the epoch based reclamation used by EasyLua's lock-free readers.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_EPOCH_HPP_
+#define _INCLUDE_EASYLUA_EPOCH_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Epoch based reclamation for data published through atomic pointer swaps. Readers
+     *  announce the epoch they entered in so that writers know when retired data can no longer
+     *  be observed and may be freed. Reading never takes a lock; only registering readers,
+     *  retiring and reclaiming do.
+     */
+    class EpochDomain
+    {
+        // Public Members
+        public:
+            /**
+             *  @brief A reader slot. Each thread of execution that reads published data needs its own
+             *  slot, which must not be used by two threads at once.
+             */
+            class Reader
+            {
+                friend class EpochDomain;
+
+                // Private Members
+                private:
+                    //! The epoch the reader entered in, or 0 when the reader is not reading.
+                    std::atomic<uint64_t> mEpoch;
+
+                    //! How many guards are currently open against this reader.
+                    unsigned int mDepth;
+
+                    //! Whether the slot is currently handed out.
+                    bool mRegistered;
+
+                // Public Methods
+                public:
+                    //! Parameter-less constructor.
+                    Reader(void) : mEpoch(0), mDepth(0), mRegistered(false) { }
+            };
+
+            /**
+             *  @brief A scoped read-side critical section. Any published data loaded while the guard
+             *  exists remains valid until the guard is destroyed. Guards may be nested.
+             */
+            class Guard
+            {
+                // Private Members
+                private:
+                    //! The domain being read from.
+                    EpochDomain& mDomain;
+                    //! The reader slot used.
+                    Reader& mReader;
+
+                // Public Methods
+                public:
+                    /**
+                     *  @brief Constructor entering the critical section.
+                     *  @param domain The domain being read from.
+                     *  @param reader The reader slot of the calling thread.
+                     */
+                    Guard(EpochDomain& domain, Reader& reader) : mDomain(domain), mReader(reader) { mDomain.enter(mReader); }
+
+                    //! Standard destructor leaving the critical section.
+                    ~Guard(void) { mDomain.exit(mReader); }
+
+                    Guard(const Guard& other) = delete;
+                    Guard& operator=(const Guard& other) = delete;
+            };
+
+        // Private Members
+        private:
+            //! Data waiting to be freed.
+            struct Retired
+            {
+                //! The epoch the data was retired in.
+                uint64_t epoch;
+                //! Frees the data.
+                std::function<void()> deleter;
+            };
+
+            //! The global epoch. Starts at 1 as 0 denotes an idle reader.
+            std::atomic<uint64_t> mEpoch;
+
+            //! Guards the reader slots and retired list. Never taken by readers.
+            std::mutex mMutex;
+
+            //! All reader slots ever created. Slots are recycled but never freed while the domain lives.
+            std::vector<std::unique_ptr<Reader>> mReaders;
+
+            //! Data waiting for all readers that may observe it to leave.
+            std::vector<Retired> mRetired;
+
+        // Public Methods
+        public:
+            //! Parameter-less constructor.
+            EpochDomain(void);
+
+            //! Standard destructor. Frees everything still retired, so no reader may be active.
+            ~EpochDomain(void);
+
+            EpochDomain(const EpochDomain& other) = delete;
+            EpochDomain& operator=(const EpochDomain& other) = delete;
+
+            /**
+             *  @brief Hands out a reader slot.
+             *  @return The reader slot, owned by the domain.
+             */
+            Reader* registerReader(void);
+
+            /**
+             *  @brief Returns a reader slot to the domain.
+             *  @param reader The reader slot to return. It must not be inside a guard.
+             */
+            void unregisterReader(Reader* reader);
+
+            /**
+             *  @brief Enters a read-side critical section. Prefer Guard.
+             *  @param reader The reader slot of the calling thread.
+             */
+            void enter(Reader& reader)
+            {
+                if (reader.mDepth++ == 0)
+                    reader.mEpoch.store(mEpoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+            }
+
+            /**
+             *  @brief Leaves a read-side critical section. Prefer Guard.
+             *  @param reader The reader slot of the calling thread.
+             */
+            void exit(Reader& reader)
+            {
+                if (--reader.mDepth == 0)
+                    reader.mEpoch.store(0, std::memory_order_release);
+            }
+
+            /**
+             *  @brief Schedules data that was just unpublished to be freed once no reader can observe it.
+             *  @param deleter Frees the data.
+             *  @note The data must already be unreachable for new readers, such as after an atomic swap.
+             */
+            void retire(std::function<void()> deleter);
+
+            /**
+             *  @brief Frees all retired data that no reader can still observe.
+             *  @return The number of retired items that are still pending.
+             */
+            size_t reclaim(void);
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_EPOCH_HPP_
@@ -0,0 +1,228 @@
+/**
+ *  @file easylua_events.hpp
+ *  @brief Include file declaring batched event dispatch to Lua handlers.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_EVENTS_HPP_
+#define _INCLUDE_EASYLUA_EVENTS_HPP_
+
+#include <chrono>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Describes one field of an event: the key it is stored under in the Lua record and the member
+     *  it is read from.
+     */
+    template <typename event, typename type>
+    struct EventField
+    {
+        //! The key the field is stored under.
+        const char* name;
+        //! The member the field is read from.
+        type event::* member;
+    };
+
+    /**
+     *  @brief Describes one field of an event.
+     *  @param name The key the field is stored under in the Lua record.
+     *  @param member The member the field is read from.
+     *  @return The field description.
+     */
+    template <typename event, typename type>
+    static INLINE EventField<event, type> field(const char* name, type event::* member)
+    {
+        return EventField<event, type> { name, member };
+    }
+
+    /**
+     *  @brief Buffers events in C++ and delivers them to a Lua handler in batches. Each flush performs a
+     *  single call whose only argument is an array of records, one per event, with one key per field.
+     *  A flush happens once the batch is full, or on publish or poll once the oldest buffered event has
+     *  waited for the maximum delay.
+     *
+     *  @code
+     *  EasyLua::EventBus bus(lua, "onInput", 64, std::chrono::milliseconds(5),
+     *      EasyLua::field("key", &Input::key), EasyLua::field("pressed", &Input::pressed));
+     *  @endcode
+     *  @warning The state must outlive the bus. Events still buffered on destruction are discarded.
+     */
+    template <typename event, typename... types>
+    class EventBus
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param lua The state to deliver events to.
+             *  @param handler The name of the global function handling batches. It is resolved once, here.
+             *  @param batchSize The number of events that triggers a flush.
+             *  @param maximumDelay How long an event may wait before a flush is triggered.
+             *  @param fields The fields of each event to deliver.
+             *  @throw std::runtime_error Thrown if the handler is not a function.
+             */
+            EventBus(lua_State* lua, const char* handler, const size_t& batchSize, const std::chrono::nanoseconds& maximumDelay,
+            const EventField<event, types>&... fields) : mLua(lua), mFields(fields...), mBatchSize(batchSize), mMaximumDelay(maximumDelay)
+            {
+                lua_getglobal(lua, handler);
+                if (lua_type(lua, -1) != LUA_TFUNCTION)
+                {
+                    lua_pop(lua, 1);
+                    throw std::runtime_error("Event handler is not a function!");
+                }
+                mHandler = luaL_ref(lua, LUA_REGISTRYINDEX);
+
+                // Intern the field names once so records are filled with rawset rather than setfield
+                lua_createtable(lua, sizeof...(types), 0);
+                std::apply([lua](const EventField<event, types>&... descriptors)
+                {
+                    lua_Integer index = 1;
+                    ((lua_pushstring(lua, descriptors.name), lua_rawseti(lua, -2, index++)), ...);
+                }, mFields);
+                mKeys = luaL_ref(lua, LUA_REGISTRYINDEX);
+
+                mEvents.reserve(batchSize);
+            }
+
+            //! Standard destructor.
+            ~EventBus(void)
+            {
+                luaL_unref(mLua, LUA_REGISTRYINDEX, mHandler);
+                luaL_unref(mLua, LUA_REGISTRYINDEX, mKeys);
+            }
+
+            EventBus(const EventBus& other) = delete;
+            EventBus& operator=(const EventBus& other) = delete;
+
+            /**
+             *  @brief Buffers an event, flushing if the batch is full or the oldest event waited too long.
+             *  @param in The event to buffer.
+             *  @return True if a flush happened.
+             *  @throw std::runtime_error Thrown if the handler raised an error.
+             */
+            bool publish(const event& in)
+            {
+                if (mEvents.empty())
+                    mOldest = std::chrono::steady_clock::now();
+
+                mEvents.push_back(in);
+
+                if (mEvents.size() >= mBatchSize)
+                {
+                    this->flush();
+                    return true;
+                }
+
+                return this->poll();
+            }
+
+            /**
+             *  @brief Flushes if the oldest buffered event waited for the maximum delay. Call this periodically
+             *  when events may stop arriving.
+             *  @return True if a flush happened.
+             *  @throw std::runtime_error Thrown if the handler raised an error.
+             */
+            bool poll(void)
+            {
+                if (mEvents.empty() || std::chrono::steady_clock::now() - mOldest < mMaximumDelay)
+                    return false;
+
+                this->flush();
+                return true;
+            }
+
+            /**
+             *  @brief Delivers all buffered events to the handler.
+             *  @return The number of events delivered.
+             *  @throw std::runtime_error Thrown if the handler raised an error. The events are dropped either way.
+             */
+            size_t flush(void)
+            {
+                const size_t count = mEvents.size();
+                if (count == 0)
+                    return 0;
+
+                lua_rawgeti(mLua, LUA_REGISTRYINDEX, mHandler);
+                lua_rawgeti(mLua, LUA_REGISTRYINDEX, mKeys);
+                const int keys = lua_gettop(mLua);
+
+                lua_createtable(mLua, static_cast<int>(count), 0);
+
+                for (size_t index = 0; index < count; ++index)
+                {
+                    lua_createtable(mLua, 0, sizeof...(types));
+                    this->pushRecord(keys, mEvents[index], std::index_sequence_for<types...>());
+                    lua_rawseti(mLua, -2, static_cast<lua_Integer>(index + 1));
+                }
+
+                mEvents.clear();
+
+                // Drop the keys from between the handler and its argument
+                lua_remove(mLua, keys);
+
+                if (lua_pcall(mLua, 1, 0, 0) != LUA_OK)
+                {
+                    const std::string message = lua_tostring(mLua, -1) ? lua_tostring(mLua, -1) : "(error object is not a string)";
+                    lua_pop(mLua, 1);
+                    throw std::runtime_error(message);
+                }
+
+                return count;
+            }
+
+            //! Returns the number of buffered events.
+            size_t pending(void) const { return mEvents.size(); }
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Fills the record on top of the stack with the fields of an event.
+             *  @param keys The absolute stack index of the interned field names.
+             *  @param in The event to read.
+             */
+            template <size_t... indices>
+            INLINE void pushRecord(const int& keys, const event& in, std::index_sequence<indices...>)
+            {
+                ((lua_rawgeti(mLua, keys, static_cast<lua_Integer>(indices + 1)),
+                  EasyLua::Utilities::pushParameters(mLua, in.*(std::get<indices>(mFields).member)),
+                  lua_rawset(mLua, -3)), ...);
+            }
+
+        // Private Members
+        private:
+            //! The state events are delivered to.
+            lua_State* mLua;
+            //! The fields delivered per event.
+            std::tuple<EventField<event, types>...> mFields;
+            //! The number of events that triggers a flush.
+            size_t mBatchSize;
+            //! How long an event may wait before a flush is triggered.
+            std::chrono::nanoseconds mMaximumDelay;
+            //! A registry reference to the handler.
+            int mHandler;
+            //! A registry reference to the interned field names.
+            int mKeys;
+            //! The buffered events.
+            std::vector<event> mEvents;
+            //! When the oldest buffered event was published.
+            std::chrono::steady_clock::time_point mOldest;
+    };
+
+    template <typename event, typename... types>
+    EventBus(lua_State*, const char*, const size_t&, const std::chrono::nanoseconds&, const EventField<event, types>&...) -> EventBus<event, types...>;
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_EVENTS_HPP_
@@ -0,0 +1,146 @@
+/**
+ *  @file easylua_gc.hpp
+ *  @brief Include file declaring explicit garbage collection scheduling.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_GC_HPP_
+#define _INCLUDE_EASYLUA_GC_HPP_
+
+#include <chrono>
+#include <cstdint>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Moves garbage collection of a state out of the latency critical path. Collection can be
+     *  suspended around batches of calls and caught up on in bounded steps during idle windows.
+     *  @note Only the collection work performed through the controller is timed. While collection is
+     *  suspended that is all of it; otherwise the collector also runs implicitly during allocations.
+     */
+    class GCController
+    {
+        // Public Members
+        public:
+            //! Collection statistics.
+            struct Statistics
+            {
+                //! The number of steps performed.
+                uint64_t steps;
+                //! The number of collection cycles completed.
+                uint64_t cycles;
+                //! The total time spent collecting.
+                std::chrono::nanoseconds time;
+                //! The longest single step or collection.
+                std::chrono::nanoseconds longest;
+            };
+
+            /**
+             *  @brief Suspends collection for as long as it exists.
+             */
+            class Suspension
+            {
+                // Private Members
+                private:
+                    //! The controller suspended.
+                    GCController& mController;
+
+                // Public Methods
+                public:
+                    /**
+                     *  @brief Constructor suspending collection.
+                     *  @param controller The controller to suspend.
+                     */
+                    Suspension(GCController& controller) : mController(controller) { mController.suspend(); }
+
+                    //! Standard destructor resuming collection.
+                    ~Suspension(void) { mController.resume(); }
+
+                    Suspension(const Suspension& other) = delete;
+                    Suspension& operator=(const Suspension& other) = delete;
+            };
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param lua The state to control.
+             */
+            GCController(lua_State* lua);
+
+            /**
+             *  @brief Switches the state to incremental collection.
+             *  @param pause The collector pause in percent, 0 keeps the current value.
+             *  @param stepMultiplier The step multiplier in percent, 0 keeps the current value.
+             *  @param stepSize The log2 of the step size in kilobytes, 0 keeps the current value. Lua 5.4 only.
+             */
+            void incremental(const int& pause = 0, const int& stepMultiplier = 0, const int& stepSize = 0);
+
+            /**
+             *  @brief Switches the state to generational collection.
+             *  @param minorMultiplier The minor collection multiplier in percent, 0 keeps the current value.
+             *  @param majorMultiplier The major collection multiplier in percent, 0 keeps the current value.
+             *  @throw std::runtime_error Thrown when built against a Lua version without generational collection.
+             */
+            void generational(const int& minorMultiplier = 0, const int& majorMultiplier = 0);
+
+            /**
+             *  @brief Suspends collection. Suspensions nest; collection resumes once every suspend was matched by a
+             *  resume, and only if it was running before the first one.
+             */
+            void suspend(void);
+
+            //! Ends a suspension.
+            void resume(void);
+
+            //! Returns whether collection is currently suspended through this controller.
+            bool suspended(void) const { return mSuspensions != 0; }
+
+            /**
+             *  @brief Performs collection steps until the time budget is spent or a cycle completes. Works while
+             *  suspended, which is the intended use: suspend during requests, step while idle.
+             *  @param budget How long to spend collecting. At least one step is always performed.
+             *  @param stepSize The size of each step as passed to LUA_GCSTEP.
+             *  @return True if a collection cycle completed.
+             */
+            bool idle(const std::chrono::nanoseconds& budget, const int& stepSize = 0);
+
+            //! Performs a full collection.
+            void collect(void);
+
+            //! Returns the number of bytes in use by the state.
+            size_t memory(void) const;
+
+            //! Returns the collection statistics.
+            const Statistics& statistics(void) const { return mStatistics; }
+
+            //! Clears the collection statistics.
+            void resetStatistics(void);
+
+        // Private Methods
+        private:
+            //! Records a step or collection that took the given time.
+            void record(const std::chrono::nanoseconds& time);
+
+        // Private Members
+        private:
+            //! The state being controlled.
+            lua_State* mLua;
+            //! The number of active suspensions.
+            unsigned int mSuspensions;
+            //! Whether collection was running before the first suspension.
+            bool mWasRunning;
+            //! The collection statistics.
+            Statistics mStatistics;
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_GC_HPP_
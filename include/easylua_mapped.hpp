@@ -0,0 +1,236 @@
+/**
+ *  @file easylua_mapped.hpp
+ *  @brief Include file declaring the binary Table format and its memory mapped views.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_MAPPED_HPP_
+#define _INCLUDE_EASYLUA_MAPPED_HPP_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief The layout of files written by Table::serialize. All integers are stored in host byte order,
+     *  which the header records so that files from hosts of the other order are rejected.
+     *
+     *  The file starts with a Header. Every string, keys included, is stored as a 32-bit length followed by the
+     *  bytes and a terminating NUL. Every table is stored as a Node: a 64-bit entry count followed by its
+     *  Entries sorted by key, each referring to its key, string values and subtables by file offset. Subtables
+     *  are written before their parents, so the root is the last node in the file.
+     */
+    namespace MappedFormat
+    {
+        //! The magic bytes every file starts with.
+        static constexpr char MAGIC[4] = { 'E', 'L', 'T', 'B' };
+
+        //! The current format version. Bumped on any incompatible change.
+        static constexpr uint32_t VERSION = 1;
+
+        //! Written as-is to detect files of the other byte order.
+        static constexpr uint32_t ORDER_MARK = 0x01020304;
+
+        //! The deepest nesting of subtables pushed to Lua, guarding against corrupt files whose nodes refer to themselves.
+        static constexpr unsigned int MAXIMUM_DEPTH = 64;
+
+        //! The file header.
+        struct Header
+        {
+            //! Always MAGIC.
+            char magic[4];
+            //! The format version.
+            uint32_t version;
+            //! Always ORDER_MARK in the byte order of the writer.
+            uint32_t byteOrder;
+            //! Reserved, always 0.
+            uint32_t reserved;
+            //! The offset of the root node.
+            uint64_t root;
+            //! The size of the entire file.
+            uint64_t size;
+        };
+
+        //! A single entry of a node.
+        struct Entry
+        {
+            //! The offset of the key.
+            uint64_t key;
+            //! The integer, the float bits, or the offset of the string or node, depending on type.
+            uint64_t value;
+            //! The length of the key, duplicated here for cheap comparisons.
+            uint32_t keyLength;
+            //! The EasyLua type ID of the value.
+            uint8_t type;
+            //! Reserved, always 0.
+            uint8_t reserved[3];
+        };
+    } // End NameSpace MappedFormat
+
+    /**
+     *  @brief A read-only view of one table inside a TableMapping. Everything is read directly from the
+     *  mapped pages; lookups are a binary search over the sorted entries and strings are returned without
+     *  copying. Views are cheap to copy.
+     *  @warning The TableMapping must outlive every view into it.
+     */
+    class MappedTable
+    {
+        // Public Methods
+        public:
+            //! Constructs an empty view that refers to nothing.
+            MappedTable(void) : mBase(nullptr), mSize(0), mCount(0), mEntries(nullptr) { }
+
+            /**
+             *  @brief Constructor.
+             *  @param base The start of the mapped file.
+             *  @param size The size of the mapped file.
+             *  @param offset The offset of the node to view.
+             *  @throw std::runtime_error Thrown if the node lies outside of the file.
+             */
+            MappedTable(const char* base, const size_t& size, const uint64_t& offset);
+
+            //! Returns the number of entries in the table.
+            size_t size(void) const { return mCount; }
+
+            /**
+             *  @brief Returns whether the table has an entry for the given key.
+             *  @param key The key to look up.
+             */
+            bool contains(const std::string_view& key) const { return this->find(key) != nullptr; }
+
+            /**
+             *  @brief Returns the EasyLua type ID of the value stored on the given key.
+             *  @param key The key to look up.
+             *  @throw std::out_of_range Thrown when the requested key does not exist.
+             */
+            unsigned char type(const std::string_view& key) const;
+
+            /**
+             *  @brief Reads the property in the table, mirroring Table::get.
+             *  @param key The name of the property to read.
+             *  @param out The reference to read out to.
+             *  @throw std::runtime_error Thrown when there is a type mismatch.
+             *  @throw std::out_of_range Thrown when the requested key does not exist, or when an integer does not
+             *  fit into an int. Read those as lua_Integer instead, which holds any stored integer.
+             */
+            void get(const std::string_view& key, int& out) const;
+            void get(const std::string_view& key, lua_Integer& out) const;
+            void get(const std::string_view& key, float& out) const;
+            void get(const std::string_view& key, std::string& out) const;
+            void get(const std::string_view& key, std::string_view& out) const;
+            void get(const std::string_view& key, MappedTable& out) const;
+
+            /**
+             *  @brief Pushes a Lua table with the contents of this table, subtables included, straight from the
+             *  mapped pages without building an EasyLua::Table first.
+             *  @param lua The Lua state to push the table to.
+             *  @throw std::runtime_error Thrown when subtables nest deeper than MappedFormat::MAXIMUM_DEPTH, as only
+             *  corrupt files do, or the stack cannot be grown. Nothing is left on the stack.
+             */
+            void push(lua_State* lua) const;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Pushes this table like push, recursing into subtables.
+             *  @param lua The Lua state to push the table to.
+             *  @param depth How deeply this table is nested below the one push was called on.
+             */
+            void pushNode(lua_State* lua, const unsigned int& depth) const;
+
+            /**
+             *  @brief Reads the entry at the given position.
+             *  @param index The position of the entry.
+             */
+            MappedFormat::Entry entry(const size_t& index) const;
+
+            /**
+             *  @brief Returns the key of an entry.
+             *  @param in The entry.
+             */
+            std::string_view key(const MappedFormat::Entry& in) const;
+
+            /**
+             *  @brief Returns the string stored at the given offset.
+             *  @param offset The offset of the length prefix.
+             */
+            std::string_view string(const uint64_t& offset) const;
+
+            /**
+             *  @brief Looks up an entry by key.
+             *  @param key The key to look up.
+             *  @return A pointer to the entry in the mapping, or nullptr if there is no such key.
+             */
+            const char* find(const std::string_view& key) const;
+
+            /**
+             *  @brief Looks up an entry by key and checks its type.
+             *  @param key The key to look up.
+             *  @param type The EasyLua type ID expected.
+             *  @throw std::runtime_error Thrown when there is a type mismatch.
+             *  @throw std::out_of_range Thrown when the requested key does not exist.
+             */
+            MappedFormat::Entry expect(const std::string_view& key, const unsigned char& type) const;
+
+        // Private Members
+        private:
+            //! The start of the mapped file.
+            const char* mBase;
+            //! The size of the mapped file.
+            size_t mSize;
+            //! The number of entries.
+            size_t mCount;
+            //! The first entry.
+            const char* mEntries;
+    };
+
+    /**
+     *  @brief A file written by Table::serialize, mapped into memory. Opening a mapping only validates the
+     *  header; pages are loaded by the operating system as they are read.
+     *  @note On Windows the file is read into memory instead of being mapped.
+     */
+    class TableMapping
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor mapping the given file.
+             *  @param path The file to map.
+             *  @throw std::runtime_error Thrown if the file cannot be mapped or is not a valid table file.
+             */
+            TableMapping(const std::string& path);
+
+            //! Standard destructor. Unmaps the file.
+            ~TableMapping(void);
+
+            TableMapping(const TableMapping& other) = delete;
+            TableMapping& operator=(const TableMapping& other) = delete;
+
+            //! Returns a view of the root table.
+            const MappedTable& root(void) const { return mRoot; }
+
+        // Private Members
+        private:
+            //! The start of the mapping.
+            const char* mBase;
+            //! The size of the mapping.
+            size_t mSize;
+            //! The file contents, when they could not be mapped.
+            std::vector<char> mBuffer;
+            //! A view of the root table.
+            MappedTable mRoot;
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_MAPPED_HPP_
@@ -0,0 +1,181 @@
+/**
+ *  @file easylua_memoize.hpp
+ *  @brief Include file declaring the memoization cache for pure Lua functions.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_MEMOIZE_HPP_
+#define _INCLUDE_EASYLUA_MEMOIZE_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Caches the results of pure global Lua functions by their arguments. Functions must be marked
+     *  cacheable first; calls to any other function pass straight through to EasyLua::call and EasyLua::pcall.
+     *
+     *  The arguments are pushed through their converters as usual and then encoded by EasyLua::ValueCodec,
+     *  tables included, which makes the encoding the cache key. A hit pushes the cached results without
+     *  entering the Lua VM at all. Entries are evicted in least recently used order once the capacity is
+     *  reached, and expire after the time to live if one was given.
+     *  @note Results are cached in encoded form, so every hit returns fresh copies of any tables. Calls whose
+     *  arguments or results hold functions, userdata or threads are never cached, and neither are calls that
+     *  fail.
+     *  @warning Marking a function cacheable asserts that it is pure: its results must depend on its arguments
+     *  only. Call clear after reloading scripts.
+     */
+    class Memoizer
+    {
+        // Public Members
+        public:
+            //! Counters describing how effective the cache is.
+            struct Statistics
+            {
+                //! Calls answered from the cache.
+                uint64_t hits;
+                //! Calls of cacheable functions that had to run.
+                uint64_t misses;
+                //! Entries dropped to stay within the capacity.
+                uint64_t evictions;
+                //! Entries dropped because their time to live passed.
+                uint64_t expirations;
+                //! Calls of cacheable functions that could not be cached due to their arguments or results.
+                uint64_t uncacheable;
+            };
+
+        // Private Members
+        private:
+            //! A single cached result.
+            struct Entry
+            {
+                //! The key of the entry, owned by mEntries.
+                const std::string* key;
+                //! The encoded results.
+                std::string results;
+                //! When the entry expires.
+                std::chrono::steady_clock::time_point expires;
+            };
+
+            //! The state the functions live in.
+            lua_State* mLua;
+
+            //! The maximum number of entries.
+            size_t mCapacity;
+
+            //! How long entries are valid for, or zero if they never expire.
+            std::chrono::nanoseconds mTimeToLive;
+
+            //! The names of the functions that may be cached.
+            std::unordered_set<std::string> mCacheable;
+
+            //! The entries from most to least recently used.
+            std::list<Entry> mOrder;
+
+            //! The entries by function name and encoded arguments.
+            std::unordered_map<std::string, std::list<Entry>::iterator> mEntries;
+
+            //! The counters.
+            Statistics mStatistics;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Answers a call of a cacheable function whose arguments were already pushed, either from the
+             *  cache or by calling it and caching the results.
+             *  @param methodName The name of the function.
+             *  @param parameterCount The number of arguments on top of the stack.
+             *  @param protect Whether to call the function protected on a miss.
+             *  @return The status and the number of results pushed in place of the arguments.
+             */
+            std::pair<int, size_t> resolve(const char* methodName, const int& parameterCount, const bool& protect);
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param lua The state the functions live in.
+             *  @param capacity The maximum number of cached results across all functions.
+             *  @param timeToLive How long results stay valid, or zero for as long as they are not evicted.
+             */
+            Memoizer(lua_State* lua, const size_t& capacity, const std::chrono::nanoseconds& timeToLive = std::chrono::nanoseconds::zero());
+
+            Memoizer(const Memoizer& other) = delete;
+            Memoizer& operator=(const Memoizer& other) = delete;
+
+            /**
+             *  @brief Marks a global function as cacheable or not. Making a function uncacheable drops its results.
+             *  @param methodName The name of the function.
+             *  @param cacheable Whether its results may be cached.
+             */
+            void setCacheable(const std::string& methodName, const bool& cacheable = true);
+
+            //! Returns whether the given global function is cacheable.
+            bool isCacheable(const std::string& methodName) const { return mCacheable.find(methodName) != mCacheable.end(); }
+
+            //! Drops every cached result.
+            void clear(void);
+
+            /**
+             *  @brief Drops the cached results of one function.
+             *  @param methodName The name of the function.
+             */
+            void clear(const std::string& methodName);
+
+            //! Returns the number of cached results.
+            size_t size(void) const { return mOrder.size(); }
+
+            //! Returns the counters.
+            const Statistics& statistics(void) const { return mStatistics; }
+
+            //! Resets the counters to zero.
+            void resetStatistics(void);
+
+            /**
+             *  @brief Calls a global function like EasyLua::call, answering from the cache when possible.
+             *  @param methodName The name of the function.
+             *  @param params The arguments.
+             *  @return The number of values returned.
+             */
+            template <typename... parameters>
+            size_t call(const char* methodName, parameters... params)
+            {
+                if (!this->isCacheable(methodName))
+                    return EasyLua::call(mLua, methodName, params...);
+
+                EasyLua::Utilities::pushParameters(mLua, params...);
+                return this->resolve(methodName, static_cast<int>(sizeof...(params)), false).second;
+            }
+
+            /**
+             *  @brief Calls a global function like EasyLua::pcall, answering from the cache when possible.
+             *  @param methodName The name of the function.
+             *  @param params The arguments.
+             *  @return The status and the number of values returned.
+             */
+            template <typename... parameters>
+            std::pair<int, size_t> pcall(const char* methodName, parameters... params)
+            {
+                if (!this->isCacheable(methodName))
+                    return EasyLua::pcall(mLua, methodName, params...);
+
+                EasyLua::Utilities::pushParameters(mLua, params...);
+                return this->resolve(methodName, static_cast<int>(sizeof...(params)), true);
+            }
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_MEMOIZE_HPP_
@@ -0,0 +1,147 @@
+/**
+ *  @file easylua_memory.hpp
+ *  @brief Include file declaring memory accounting for Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_MEMORY_HPP_
+#define _INCLUDE_EASYLUA_MEMORY_HPP_
+
+#include <atomic>
+#include <functional>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief An allocator that accounts for the memory of the states created through it. An account may
+     *  be shared by several states, for instance all states of one tenant, in which case the figures and
+     *  limits apply to all of them together.
+     *
+     *  Allocations that would grow the account past its hard limit fail, which Lua reports as a memory
+     *  error (LUA_ERRMEM) to the innermost pcall after an emergency collection did not help.
+     */
+    class MemoryAccount
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param hardLimit The number of bytes allocations may never exceed. 0 disables the limit.
+             *  @param softLimit The number of bytes past which the soft limit callback is called. 0 disables the limit.
+             */
+            MemoryAccount(const size_t& hardLimit = 0, const size_t& softLimit = 0);
+
+            MemoryAccount(const MemoryAccount& other) = delete;
+            MemoryAccount& operator=(const MemoryAccount& other) = delete;
+
+            /**
+             *  @brief Creates a new state whose allocations are charged to this account.
+             *  @return The new state. No libraries are opened.
+             *  @throw std::runtime_error Thrown if the state could not be created within the hard limit.
+             *  @warning The account must outlive every state created through it.
+             */
+            lua_State* newState(void);
+
+            /**
+             *  @brief Returns the account the given state allocates from.
+             *  @param lua The state to look up.
+             *  @return The account, or nullptr if the state was not created through one.
+             */
+            static MemoryAccount* get(lua_State* lua);
+
+            //! Returns the number of bytes currently allocated.
+            size_t current(void) const { return mCurrent.load(std::memory_order_relaxed); }
+
+            //! Returns the highest number of bytes allocated at any time since creation or the last resetPeak.
+            size_t peak(void) const { return mPeak.load(std::memory_order_relaxed); }
+
+            //! Returns the number of allocations made.
+            size_t allocations(void) const { return mAllocations.load(std::memory_order_relaxed); }
+
+            //! Returns the number of allocations released.
+            size_t frees(void) const { return mFrees.load(std::memory_order_relaxed); }
+
+            //! Returns the number of allocations refused because of the hard limit.
+            size_t failures(void) const { return mFailures.load(std::memory_order_relaxed); }
+
+            //! Lowers the peak to the current usage.
+            void resetPeak(void) { mPeak.store(this->current(), std::memory_order_relaxed); }
+
+            //! Returns the hard limit in bytes.
+            size_t hardLimit(void) const { return mHardLimit.load(std::memory_order_relaxed); }
+
+            //! Returns the soft limit in bytes.
+            size_t softLimit(void) const { return mSoftLimit.load(std::memory_order_relaxed); }
+
+            /**
+             *  @brief Changes the hard limit. Memory already allocated past a lowered limit is not reclaimed, but
+             *  further growth fails.
+             *  @param limit The new limit in bytes. 0 disables the limit.
+             */
+            void setHardLimit(const size_t& limit) { mHardLimit.store(limit, std::memory_order_relaxed); }
+
+            /**
+             *  @brief Changes the soft limit.
+             *  @param limit The new limit in bytes. 0 disables the limit.
+             */
+            void setSoftLimit(const size_t& limit) { mSoftLimit.store(limit, std::memory_order_relaxed); }
+
+            /**
+             *  @brief Sets the function called once each time the account grows past its soft limit. It is called
+             *  again only after usage dropped back below the limit.
+             *  @param callback The function to call, or an empty function to call nothing.
+             *  @warning The callback is called from within the allocator of whichever state crossed the limit. It
+             *  must not call into any state using this account. Set it before creating states.
+             */
+            void setSoftLimitCallback(const std::function<void(MemoryAccount&)>& callback) { mSoftLimitCallback = callback; }
+
+            /**
+             *  @brief Sets the function called when a state using this account raises an error outside of any
+             *  protected call, right before Lua aborts the process.
+             *  @param callback The function to call with the error message, or an empty function to call nothing.
+             *  @note Set it before creating states.
+             */
+            void setPanicCallback(const std::function<void(MemoryAccount&, const char*)>& callback) { mPanicCallback = callback; }
+
+        // Private Methods
+        private:
+            //! The lua_Alloc implementation.
+            static void* allocate(void* account, void* memory, size_t oldSize, size_t newSize);
+
+            //! The panic handler installed on every state.
+            static int panic(lua_State* lua);
+
+        // Private Members
+        private:
+            //! The bytes currently allocated.
+            std::atomic<size_t> mCurrent;
+            //! The peak of mCurrent.
+            std::atomic<size_t> mPeak;
+            //! The number of allocations made.
+            std::atomic<size_t> mAllocations;
+            //! The number of allocations released.
+            std::atomic<size_t> mFrees;
+            //! The number of allocations refused.
+            std::atomic<size_t> mFailures;
+            //! The hard limit, 0 if disabled.
+            std::atomic<size_t> mHardLimit;
+            //! The soft limit, 0 if disabled.
+            std::atomic<size_t> mSoftLimit;
+            //! Whether usage is past the soft limit and the callback was already called.
+            std::atomic<bool> mSoftLimitReached;
+            //! Called when usage grows past the soft limit.
+            std::function<void(MemoryAccount&)> mSoftLimitCallback;
+            //! Called with the error message when a state panics.
+            std::function<void(MemoryAccount&, const char*)> mPanicCallback;
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_MEMORY_HPP_
@@ -0,0 +1,177 @@
+/**
+ *  @file easylua_methods.hpp
+ *  @brief Include file declaring cached object and method references.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_METHODS_HPP_
+#define _INCLUDE_EASYLUA_METHODS_HPP_
+
+#include <string>
+#include <vector>
+
+#include <easylua.hpp>
+#include <easylua_reload.hpp>
+
+namespace EasyLua
+{
+    class MethodRef;
+
+    /**
+     *  @brief A registry reference to a Lua object, such as a table or userdata, that methods are called on.
+     *  Every MethodRef bound to the object is tracked so that all of them can be dropped at once when the
+     *  object goes away.
+     *  @warning The state must outlive the handle.
+     */
+    class ObjectRef
+    {
+        friend class MethodRef;
+
+        // Private Members
+        private:
+            //! The state the object lives in.
+            lua_State* mLua;
+            //! A registry reference to the object.
+            int mReference;
+            //! The reloader whose updates should invalidate cached methods, if any.
+            ScriptReloader* mReloader;
+            //! The methods bound to this object.
+            std::vector<MethodRef*> mMethods;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param lua The state the object lives in.
+             *  @param index The stack index of the object.
+             *  @param reloader The reloader whose updates should invalidate cached methods, if any.
+             */
+            ObjectRef(lua_State* lua, const int& index, ScriptReloader* reloader = nullptr);
+
+            //! Standard destructor. Invalidates every bound method.
+            ~ObjectRef(void);
+
+            ObjectRef(const ObjectRef& other) = delete;
+            ObjectRef& operator=(const ObjectRef& other) = delete;
+
+            /**
+             *  @brief Drops the reference to the object along with the cached references of every method bound
+             *  to it. Call this when the object is destroyed; the bound methods throw if used afterwards.
+             */
+            void invalidate(void);
+
+            //! Returns whether the object is still referenced.
+            bool isValid(void) const { return mReference != LUA_NOREF; }
+
+            //! Returns the state the object lives in.
+            lua_State* state(void) const { return mLua; }
+
+            /**
+             *  @brief Pushes the object to the Lua stack.
+             *  @throw std::runtime_error Thrown when the object was invalidated.
+             */
+            void push(void);
+    };
+
+    /**
+     *  @brief A cached handle to a method of a Lua object. Both the object and the method are held as
+     *  registry references, so a call of self:method(...) costs two lua_rawgeti calls rather than a global
+     *  lookup and a field lookup through any __index chain. When the object is attached to a ScriptReloader,
+     *  the method is looked up again the first time it is used after the state installed new chunks.
+     *  @warning The object must not change its method after the first call unless invalidate is called.
+     */
+    class MethodRef
+    {
+        friend class ObjectRef;
+
+        // Private Members
+        private:
+            //! The object the method is bound to, or nullptr once the object was invalidated.
+            ObjectRef* mObject;
+            //! The name of the method.
+            std::string mName;
+            //! The generation the reference was resolved in.
+            uint64_t mGeneration;
+            //! A registry reference to the method.
+            int mReference;
+
+        // Private Methods
+        private:
+            //! Drops the cached method reference, leaving the binding to the object intact.
+            void release(void);
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor. The method is looked up lazily on first use.
+             *  @param object The object to bind to.
+             *  @param name The name of the method.
+             */
+            MethodRef(ObjectRef& object, const std::string& name);
+
+            //! Standard destructor.
+            ~MethodRef(void);
+
+            MethodRef(const MethodRef& other) = delete;
+            MethodRef& operator=(const MethodRef& other) = delete;
+
+            //! Drops the cached method so that the next use looks it up again.
+            void invalidate(void) { this->release(); }
+
+            //! Returns whether the object this method is bound to is still valid.
+            bool isValid(void) const { return mObject != nullptr; }
+
+            /**
+             *  @brief Pushes the method followed by the object to the Lua stack, ready for the parameters
+             *  of a call.
+             *  @throw std::runtime_error Thrown when the object was invalidated or has no such method.
+             */
+            void push(void);
+
+            /**
+             *  @brief Performs an unprotected call of self:method(params...).
+             *  @param params The parameters to pass after self.
+             *  @return The number of values returned.
+             *  @throw std::runtime_error Thrown when the object was invalidated or has no such method.
+             */
+            template <typename... parameters>
+            INLINE unsigned int call(parameters... params)
+            {
+                this->push();
+                lua_State* lua = mObject->mLua;
+
+                const int oldTop = lua_gettop(lua) - 2;
+                EasyLua::Utilities::pushParameters(lua, params...);
+
+                lua_call(lua, sizeof...(params) + 1, LUA_MULTRET);
+                return lua_gettop(lua) - oldTop;
+            }
+
+            /**
+             *  @brief Performs a protected call of self:method(params...).
+             *  @param params The parameters to pass after self.
+             *  @return The status code of lua_pcall and the number of values returned.
+             *  @throw std::runtime_error Thrown when the object was invalidated or has no such method.
+             */
+            template <typename... parameters>
+            INLINE std::pair<int, size_t> pcall(parameters... params)
+            {
+                this->push();
+                lua_State* lua = mObject->mLua;
+
+                const int oldTop = lua_gettop(lua) - 2;
+                EasyLua::Utilities::pushParameters(lua, params...);
+
+                const int result = lua_pcall(lua, sizeof...(params) + 1, LUA_MULTRET, 0);
+                return std::make_pair(result, lua_gettop(lua) - oldTop);
+            }
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_METHODS_HPP_
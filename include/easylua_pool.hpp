@@ -0,0 +1,117 @@
+/**
+ *  @file easylua_pool.hpp
+ *  @brief Include file declaring pools of recyclable Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_POOL_HPP_
+#define _INCLUDE_EASYLUA_POOL_HPP_
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief A pool of Lua states prepared from a template environment. Every state is built once by
+     *  the setup function, which typically opens the libraries and loads scripts, after which the tables
+     *  reachable from the registry are snapshotted. Released states are reset back to that snapshot
+     *  rather than being closed and rebuilt.
+     *  @note A reset restores the contents and metatables of every table within the snapshot depth of
+     *  the registry, which covers the globals, loaded modules and the standard libraries by default. It
+     *  also drops every registry reference taken after setup. State hidden in upvalues, userdata or
+     *  deeper tables is not restored.
+     */
+    class StatePool
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param setup Prepares a freshly created state. Called once per state the pool creates.
+             *  @param maximumIdle How many idle states to keep around. States released beyond this are closed.
+             *  @param depth How many levels of tables, starting at the registry, are snapshotted.
+             *  @param stepSize The size of the garbage collection step run on each reset, as passed to LUA_GCSTEP.
+             */
+            StatePool(const std::function<void(lua_State*)>& setup, const size_t& maximumIdle = 16, const unsigned int& depth = 3, const int& stepSize = 64);
+
+            //! Standard destructor. Closes all idle states.
+            ~StatePool(void);
+
+            StatePool(const StatePool& other) = delete;
+            StatePool& operator=(const StatePool& other) = delete;
+
+            /**
+             *  @brief Takes a state from the pool, creating one if none are idle.
+             *  @return The state, ready for use.
+             */
+            lua_State* acquire(void);
+
+            /**
+             *  @brief Resets a state previously acquired from this pool and returns it to the pool.
+             *  @param lua The state to release.
+             */
+            void release(lua_State* lua);
+
+            /**
+             *  @brief Creates states until the given number are idle.
+             *  @param count The number of idle states wanted.
+             */
+            void reserve(const size_t& count);
+
+            //! Returns the number of idle states.
+            size_t idle(void);
+
+            /**
+             *  @brief Snapshots the tables reachable from the registry of a state.
+             *  @param lua The state to snapshot.
+             *  @param depth How many levels of tables, starting at the registry, are snapshotted.
+             */
+            static void snapshot(lua_State* lua, const unsigned int& depth = 3);
+
+            /**
+             *  @brief Restores a state to its last snapshot, clears its stack and runs a bounded garbage
+             *  collection step.
+             *  @param lua The state to reset.
+             *  @param stepSize The size of the garbage collection step, as passed to LUA_GCSTEP.
+             *  @throw std::runtime_error Thrown if the state was never snapshotted.
+             */
+            static void reset(lua_State* lua, const int& stepSize = 64);
+
+        // Private Methods
+        private:
+            //! Creates and prepares a new state.
+            lua_State* create(void);
+
+        // Private Members
+        private:
+            //! Prepares freshly created states.
+            std::function<void(lua_State*)> mSetup;
+
+            //! How many idle states to keep around.
+            size_t mMaximumIdle;
+
+            //! How many levels of tables are snapshotted.
+            unsigned int mDepth;
+
+            //! The size of the garbage collection step run on each reset.
+            int mStepSize;
+
+            //! The idle states.
+            std::vector<lua_State*> mIdle;
+
+            //! Guards mIdle.
+            std::mutex mMutex;
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_POOL_HPP_
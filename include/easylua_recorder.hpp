@@ -0,0 +1,210 @@
+/**
+ *  @file easylua_recorder.hpp
+ *  @brief Include file declaring the call recorder and the offline replayer.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_RECORDER_HPP_
+#define _INCLUDE_EASYLUA_RECORDER_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief The layout of logs written by Recorder::serialize. All integers are stored in host byte order,
+     *  which the header records so that logs from hosts of the other order are rejected.
+     *
+     *  The log starts with a Header followed by the calls in the order they were made. Every call is stored as
+     *  the 32-bit length and bytes of the function name, the 32-bit parameter count, the 32-bit length and bytes
+     *  of the parameters as encoded by EasyLua::ValueCodec, the 64-bit duration in nanoseconds and the 32-bit
+     *  status.
+     */
+    namespace RecorderFormat
+    {
+        //! The magic bytes every log starts with.
+        static constexpr char MAGIC[4] = { 'E', 'L', 'R', 'C' };
+
+        //! The current format version. Bumped on any incompatible change.
+        static constexpr uint32_t VERSION = 1;
+
+        //! Written as-is to detect logs of the other byte order.
+        static constexpr uint32_t ORDER_MARK = 0x01020304;
+
+        //! The log header.
+        struct Header
+        {
+            //! Always MAGIC.
+            char magic[4];
+            //! The format version.
+            uint32_t version;
+            //! Always ORDER_MARK in the byte order of the writer.
+            uint32_t byteOrder;
+            //! The number of calls in the log.
+            uint32_t count;
+        };
+    } // End NameSpace RecorderFormat
+
+    /**
+     *  @brief A single recorded call.
+     */
+    struct RecordedCall
+    {
+        //! The name of the global function called.
+        std::string name;
+        //! The number of parameters passed.
+        uint32_t parameterCount;
+        //! The parameters, encoded by EasyLua::ValueCodec.
+        std::string parameters;
+        //! How long the call took.
+        std::chrono::nanoseconds duration;
+        //! The status of the call.
+        int status;
+    };
+
+    /**
+     *  @brief Records every EasyLua::call and EasyLua::pcall made against one state, capturing the function
+     *  name, the parameters including tables, the duration and the status. The log may be saved and replayed
+     *  offline by EasyLua::Replayer against a fresh state loaded with the same scripts.
+     *
+     *  Recording is opt-in per state: it starts when the recorder is constructed and stops when it is destroyed.
+     *  Only outermost calls are recorded, since calls made from within a recorded call are replayed along with it.
+     *  @note Unprotected calls are run protected while recording so that their duration can be captured; their
+     *  errors are raised again afterwards.
+     *  @warning Only one recorder may be attached to a state at a time, and it must be destroyed before the state
+     *  is closed.
+     */
+    class Recorder
+    {
+        friend struct Resolvers::CallRecording;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor. Attaches the recorder to the state.
+             *  @param lua The state to record calls of.
+             *  @throw std::runtime_error Thrown when another recorder is already attached to the state.
+             */
+            Recorder(lua_State* lua);
+
+            //! Standard destructor. Detaches the recorder from the state.
+            ~Recorder(void);
+
+            Recorder(const Recorder& other) = delete;
+            Recorder& operator=(const Recorder& other) = delete;
+
+            //! Returns the calls recorded so far.
+            const std::vector<RecordedCall>& calls(void) const { return mCalls; }
+
+            //! Drops every call recorded so far.
+            void clear(void) { mCalls.clear(); }
+
+            /**
+             *  @brief Serializes the calls recorded so far into the format described by EasyLua::RecorderFormat.
+             *  @return The log.
+             */
+            std::string serialize(void) const;
+
+            /**
+             *  @brief Writes the calls recorded so far to a file.
+             *  @param path The file to write.
+             *  @throw std::runtime_error Thrown if the file could not be written.
+             */
+            void serialize(const std::string& path) const;
+
+        // Private Members
+        private:
+            //! The state being recorded.
+            lua_State* mLua;
+
+            //! The calls recorded so far.
+            std::vector<RecordedCall> mCalls;
+
+            //! The number of recorded calls currently running.
+            int mDepth;
+    };
+
+    /**
+     *  @brief Timings of one function across a replay.
+     */
+    struct ReplayStatistics
+    {
+        //! The number of calls replayed.
+        size_t calls;
+        //! The number of replayed calls that failed.
+        size_t failures;
+        //! The total duration of the calls when they were recorded.
+        std::chrono::nanoseconds recorded;
+        //! The total duration of the calls when they were replayed.
+        std::chrono::nanoseconds replayed;
+        //! The duration of the fastest replayed call.
+        std::chrono::nanoseconds fastest;
+        //! The duration of the slowest replayed call.
+        std::chrono::nanoseconds slowest;
+
+        ReplayStatistics(void) : calls(0), failures(0), recorded(0), replayed(0), fastest(std::chrono::nanoseconds::max()), slowest(0) { }
+    };
+
+    /**
+     *  @brief Re-executes a call log written by EasyLua::Recorder, entirely offline, and reports the latency of
+     *  every function against the latency recorded in the log. Comparing a log recorded with one build against
+     *  a replay with another shows per-function regressions between the builds.
+     */
+    class Replayer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor accepting a log.
+             *  @param log The log as produced by Recorder::serialize.
+             *  @throw std::runtime_error Thrown when the log is malformed.
+             */
+            Replayer(const std::string& log);
+
+            /**
+             *  @brief Loads a log from a file.
+             *  @param path The file to read.
+             *  @return The replayer.
+             *  @throw std::runtime_error Thrown when the file cannot be read or the log is malformed.
+             */
+            static Replayer load(const std::string& path);
+
+            //! Returns the calls of the log.
+            const std::vector<RecordedCall>& calls(void) const { return mCalls; }
+
+            /**
+             *  @brief Replays every call of the log in order as protected calls, discarding their results.
+             *  @param lua The state to replay against, with the same scripts loaded as the recorded state.
+             *  @param iterations How many times to replay the whole log.
+             *  @return The timings of every function by name.
+             */
+            std::map<std::string, ReplayStatistics> replay(lua_State* lua, const size_t& iterations = 1) const;
+
+            /**
+             *  @brief Formats timings as a text report with one line per function, listing the number of calls,
+             *  the mean recorded and replayed durations and the relative change.
+             *  @param statistics The timings as returned by replay.
+             *  @return The report.
+             */
+            static std::string report(const std::map<std::string, ReplayStatistics>& statistics);
+
+        // Private Members
+        private:
+            //! The calls of the log.
+            std::vector<RecordedCall> mCalls;
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_RECORDER_HPP_
@@ -0,0 +1,238 @@
+/**
+ *  @file easylua_reload.hpp
+ *  @brief Include file declaring background script hot-reloading.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_RELOAD_HPP_
+#define _INCLUDE_EASYLUA_RELOAD_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Watches script files and compiles changed ones to bytecode on a background thread. States
+     *  owning a copy of the scripts pick up the new versions at a safe point of their choosing by calling
+     *  update, which only executes the precompiled chunk. Nothing on the calling thread ever parses
+     *  source or waits for file IO.
+     */
+    class ScriptReloader
+    {
+        // Private Members
+        private:
+            //! A watched script.
+            struct Script
+            {
+                //! The path of the script.
+                std::string path;
+                //! The last seen modification time.
+                std::filesystem::file_time_type modified;
+                //! The size of the last seen contents.
+                size_t size;
+                //! The hash of the last seen contents.
+                size_t hash;
+                //! The compiled chunk, or nullptr if never compiled successfully.
+                std::shared_ptr<const std::string> bytecode;
+                //! The generation the chunk was compiled in.
+                uint64_t generation;
+                //! The last compilation error, if any.
+                std::string error;
+            };
+
+            //! All watched scripts.
+            std::vector<Script> mScripts;
+
+            //! Guards mScripts. Never held while compiling or reading files.
+            std::mutex mMutex;
+
+            //! Serializes compilation so only one thread uses the compiler state.
+            std::mutex mCompileMutex;
+
+            //! The state used purely for compilation.
+            lua_State* mCompiler;
+
+            //! Increased each time a new chunk becomes available.
+            std::atomic<uint64_t> mGeneration;
+
+            //! How often the background thread looks for changes.
+            std::chrono::milliseconds mInterval;
+
+            //! The background thread, if started.
+            std::thread mThread;
+
+            //! Whether the background thread should keep running.
+            bool mRunning;
+
+            //! Wakes the background thread early when stopping.
+            std::condition_variable mWake;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Reads and compiles a script.
+             *  @param path The path of the script.
+             *  @param source The script contents.
+             *  @param bytecode Receives the compiled chunk.
+             *  @param error Receives the error message on failure.
+             *  @return True on success.
+             */
+            bool compile(const std::string& path, const std::string& source, std::string& bytecode, std::string& error);
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param interval How often the background thread looks for changes.
+             */
+            ScriptReloader(const std::chrono::milliseconds& interval = std::chrono::milliseconds(500));
+
+            //! Standard destructor. Stops the background thread.
+            ~ScriptReloader(void);
+
+            ScriptReloader(const ScriptReloader& other) = delete;
+            ScriptReloader& operator=(const ScriptReloader& other) = delete;
+
+            /**
+             *  @brief Starts watching a script file.
+             *  @param path The path of the script.
+             *  @param initial Whether the current contents should be compiled and installed by the next update.
+             *  Pass false when the states already loaded the script themselves.
+             */
+            void watch(const std::string& path, const bool& initial = true);
+
+            //! Starts the background thread. Does nothing if already started.
+            void start(void);
+
+            //! Stops the background thread and waits for it to exit.
+            void stop(void);
+
+            /**
+             *  @brief Checks all watched scripts for changes and compiles those that changed. The background
+             *  thread calls this, but it may also be called directly when no thread is desired.
+             *  @return The number of scripts that were compiled successfully.
+             */
+            size_t poll(void);
+
+            /**
+             *  @brief Installs every chunk compiled since the last update of the given state by executing it.
+             *  Call this at a safe point between calls. When nothing changed this is a single atomic load plus
+             *  one registry lookup.
+             *  @param lua The state to update.
+             *  @param error If not nullptr, receives the error messages of chunks that failed to execute.
+             *  @return The number of chunks installed successfully.
+             */
+            size_t update(lua_State* lua, std::string* error = nullptr);
+
+            /**
+             *  @brief Returns the generation the given state was last updated to. Cached handles compare this
+             *  against what they resolved with to learn they must re-resolve.
+             *  @param lua The state to query.
+             *  @return The generation, or 0 if the state was never updated.
+             */
+            uint64_t generation(lua_State* lua);
+
+            /**
+             *  @brief Returns the last compilation error of a watched script.
+             *  @param path The path of the script.
+             *  @return The error, empty when the last compilation succeeded.
+             */
+            std::string error(const std::string& path);
+    };
+
+    /**
+     *  @brief A cached handle to a global Lua function. Calls go through a registry reference rather than
+     *  a global lookup by name. When attached to a ScriptReloader, the handle re-resolves itself the first
+     *  time it is used after the state installed new chunks.
+     *  @warning The state must outlive the handle.
+     */
+    class FunctionRef
+    {
+        // Private Members
+        private:
+            //! The state the function lives in.
+            lua_State* mLua;
+            //! The global name of the function.
+            std::string mName;
+            //! The reloader to track, if any.
+            ScriptReloader* mReloader;
+            //! The generation the reference was resolved in.
+            uint64_t mGeneration;
+            //! A registry reference to the function.
+            int mReference;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param lua The state the function lives in.
+             *  @param name The global name of the function.
+             *  @param reloader The reloader whose updates should invalidate this handle, if any.
+             */
+            FunctionRef(lua_State* lua, const std::string& name, ScriptReloader* reloader = nullptr);
+
+            //! Standard destructor.
+            ~FunctionRef(void);
+
+            FunctionRef(const FunctionRef& other) = delete;
+            FunctionRef& operator=(const FunctionRef& other) = delete;
+
+            //! Drops the cached reference so that the next use resolves the function again.
+            void invalidate(void);
+
+            //! Pushes the function to the Lua stack, resolving it first if necessary. Missing functions push nil.
+            void push(void);
+
+            /**
+             *  @brief Performs an unprotected call of the function.
+             *  @param params The parameters to pass.
+             *  @return The number of values returned.
+             */
+            template <typename... parameters>
+            INLINE unsigned int call(parameters... params)
+            {
+                const int oldTop = lua_gettop(mLua);
+
+                this->push();
+                EasyLua::Utilities::pushParameters(mLua, params...);
+
+                lua_call(mLua, sizeof...(params), LUA_MULTRET);
+                return lua_gettop(mLua) - oldTop;
+            }
+
+            /**
+             *  @brief Performs a protected call of the function.
+             *  @param params The parameters to pass.
+             *  @return The status code of lua_pcall and the number of values returned.
+             */
+            template <typename... parameters>
+            INLINE std::pair<int, size_t> pcall(parameters... params)
+            {
+                const int oldTop = lua_gettop(mLua);
+
+                this->push();
+                EasyLua::Utilities::pushParameters(mLua, params...);
+
+                const int result = lua_pcall(mLua, sizeof...(params), LUA_MULTRET, 0);
+                return std::make_pair(result, lua_gettop(mLua) - oldTop);
+            }
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_RELOAD_HPP_
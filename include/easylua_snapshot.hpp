@@ -0,0 +1,228 @@
+/**
+ *  @file easylua_snapshot.hpp
+ *  @brief Include file declaring immutable Table snapshots that may be shared between Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_SNAPSHOT_HPP_
+#define _INCLUDE_EASYLUA_SNAPSHOT_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <easylua.hpp>
+#include <easylua_epoch.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief A frozen, immutable copy of a Table tree stored in a flat layout. Every table of the tree
+     *  is an open addressed slot range within one contiguous array, keys carry precomputed hashes and
+     *  all string data lives in a single pool. Snapshots are safe to read from any number of threads.
+     */
+    class Snapshot
+    {
+        friend struct SnapshotProxy;
+
+        // Public Members
+        public:
+            //! The type ID of an unused slot.
+            static constexpr unsigned char EMPTY = 0xFF;
+
+            //! A single key and value pair.
+            struct Entry
+            {
+                //! The precomputed hash of the key.
+                uint64_t hash;
+                //! The offset of the key within the string pool.
+                uint32_t keyOffset;
+                //! The length of the key.
+                uint32_t keyLength;
+                //! The EasyLua type ID of the value, or EMPTY.
+                unsigned char type;
+
+                union
+                {
+                    //! The value of EASYLUA_INTEGER entries.
+                    lua_Integer integer;
+                    //! The value of EASYLUA_FLOAT entries.
+                    double number;
+                    //! The value of EASYLUA_STRING entries, as a range within the string pool.
+                    struct
+                    {
+                        uint32_t offset;
+                        uint32_t length;
+                    } string;
+                    //! The node index of EASYLUA_TABLE entries.
+                    uint32_t node;
+                };
+            };
+
+            //! A single table within the snapshot.
+            struct Node
+            {
+                //! The first slot of this table.
+                uint32_t firstSlot;
+                //! The number of slots, always a power of two.
+                uint32_t slotCount;
+                //! The number of occupied slots.
+                uint32_t entryCount;
+            };
+
+        // Private Members
+        private:
+            //! All tables of the tree. The root is always node 0.
+            std::vector<Node> mNodes;
+
+            //! The slots of every table.
+            std::vector<Entry> mSlots;
+
+            //! Key and string value data.
+            std::string mStrings;
+
+        // Private Methods
+        private:
+            //! Private constructor, use build.
+            Snapshot(void) { }
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Builds a snapshot of the given table tree.
+             *  @param table The root table.
+             *  @return The new snapshot.
+             */
+            static std::unique_ptr<Snapshot> build(Table& table);
+
+            /**
+             *  @brief Hashes a key the same way snapshots do.
+             *  @param key The key to hash.
+             *  @return The hash.
+             */
+            static uint64_t hash(const std::string_view& key);
+
+            /**
+             *  @brief Looks up a key.
+             *  @param node The table to look in.
+             *  @param key The key to look up.
+             *  @return The entry, or nullptr if there is no such key.
+             */
+            const Entry* find(const uint32_t& node, const std::string_view& key) const;
+
+            /**
+             *  @brief Finds the next occupied slot at or after the given slot, for iteration.
+             *  @param node The table to look in.
+             *  @param slot The slot relative to the start of the table to begin at.
+             *  @return The entry, or nullptr if there are no further entries.
+             */
+            const Entry* next(const uint32_t& node, uint32_t slot) const;
+
+            //! Returns the key of an entry.
+            std::string_view key(const Entry& entry) const { return std::string_view(mStrings.data() + entry.keyOffset, entry.keyLength); }
+
+            //! Returns the value of an EASYLUA_STRING entry.
+            std::string_view string(const Entry& entry) const { return std::string_view(mStrings.data() + entry.string.offset, entry.string.length); }
+
+            //! Returns the table at the given node index.
+            const Node& node(const uint32_t& node) const { return mNodes[node]; }
+    };
+
+    /**
+     *  @brief Publishes snapshots to any number of Lua states. States read the current snapshot through
+     *  proxy userdata without ever taking a lock, while publishing a new version is a single atomic pointer
+     *  swap. Replaced versions are freed once no state can still observe them.
+     *  @warning The store must outlive every Lua state it was pushed to.
+     */
+    class SnapshotStore
+    {
+        friend struct SnapshotProxy;
+
+        // Private Members
+        private:
+            //! A published snapshot.
+            struct Version
+            {
+                //! The snapshot data.
+                std::unique_ptr<Snapshot> snapshot;
+                //! The version number, starting at 1.
+                uint64_t number;
+                //! One reference held by the store until the version is retired, plus one per pinning proxy.
+                std::atomic<size_t> references;
+            };
+
+            //! The current version, or nullptr before the first publish.
+            std::atomic<Version*> mCurrent;
+
+            //! Reclamation of replaced versions.
+            EpochDomain mEpochs;
+
+            //! Serializes publishers.
+            std::mutex mPublishMutex;
+
+            //! The number the next published version receives.
+            uint64_t mNextNumber;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Drops a reference to a version, freeing it if that was the last one. Nothing about the
+             *  version is read after the decrement.
+             *  @param version The version to release.
+             */
+            static void release(Version* version);
+
+        // Public Methods
+        public:
+            //! Parameter-less constructor.
+            SnapshotStore(void);
+
+            //! Standard destructor.
+            ~SnapshotStore(void);
+
+            SnapshotStore(const SnapshotStore& other) = delete;
+            SnapshotStore& operator=(const SnapshotStore& other) = delete;
+
+            /**
+             *  @brief Atomically replaces the current snapshot. Readers already holding the previous version
+             *  keep reading it; everything after this call sees the new one.
+             *  @param snapshot The snapshot to publish.
+             */
+            void publish(std::unique_ptr<Snapshot> snapshot);
+
+            /**
+             *  @brief Builds a snapshot of the given table and publishes it.
+             *  @param table The table to publish.
+             */
+            void publish(Table& table) { this->publish(Snapshot::build(table)); }
+
+            /**
+             *  @brief Frees replaced versions no reader can still observe. Publishing does this as well.
+             *  @return The number of replaced versions still pending.
+             */
+            size_t reclaim(void) { return mEpochs.reclaim(); }
+
+            //! Returns the number of the current version, or 0 if nothing was published yet.
+            uint64_t version(void);
+
+            /**
+             *  @brief Pushes a read-only proxy for the current snapshot to the Lua stack. The proxy always
+             *  reads whichever version is current at the time of access. Subtables obtained through it stay
+             *  on the version they were read from.
+             *  @param lua The Lua state to push the proxy to.
+             */
+            void push(lua_State* lua);
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_SNAPSHOT_HPP_
@@ -0,0 +1,200 @@
+/**
+ *  @file easylua_tasks.hpp
+ *  @brief Include file declaring the work stealing task pool and parallel Table construction.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_TASKS_HPP_
+#define _INCLUDE_EASYLUA_TASKS_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief A fixed set of worker threads with one task deque each. Workers run their own tasks newest
+     *  first and steal the oldest tasks of others when they run dry, which keeps recursive fork and join
+     *  work such as copying table trees both local and balanced.
+     */
+    class TaskPool
+    {
+        // Public Members
+        public:
+            /**
+             *  @brief Tracks a set of tasks so that they can be waited on together.
+             */
+            class Group
+            {
+                friend class TaskPool;
+
+                // Private Members
+                private:
+                    //! The number of tasks not yet finished.
+                    std::atomic<size_t> mPending;
+
+                    //! The first exception thrown by a task of the group.
+                    std::exception_ptr mError;
+
+                    //! Guards mError.
+                    std::mutex mErrorMutex;
+
+                // Public Methods
+                public:
+                    //! Parameter-less constructor.
+                    Group(void) : mPending(0) { }
+
+                    Group(const Group& other) = delete;
+                    Group& operator=(const Group& other) = delete;
+            };
+
+        // Private Members
+        private:
+            //! A queued task.
+            struct Task
+            {
+                //! The work to do.
+                std::function<void()> function;
+                //! The group the task belongs to.
+                Group* group;
+            };
+
+            //! The queue of a single worker.
+            struct Worker
+            {
+                //! The queued tasks. The owner works at the back, thieves at the front.
+                std::deque<Task> tasks;
+                //! Guards tasks.
+                std::mutex mutex;
+            };
+
+            //! One queue per worker thread.
+            std::vector<std::unique_ptr<Worker>> mWorkers;
+
+            //! The worker threads.
+            std::vector<std::thread> mThreads;
+
+            //! The number of queued tasks across all workers.
+            std::atomic<size_t> mQueued;
+
+            //! Picks queues for tasks submitted from outside the pool.
+            std::atomic<size_t> mNextQueue;
+
+            //! Whether the workers should keep running.
+            bool mRunning;
+
+            //! Guards sleeping workers.
+            std::mutex mSleepMutex;
+
+            //! Wakes sleeping workers.
+            std::condition_variable mWake;
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Runs one queued task, preferring the given worker's own queue.
+             *  @param self The index of the calling worker, or the worker count if called from outside the pool.
+             *  @return True if a task was run.
+             */
+            bool runOne(const size_t& self);
+
+            //! Returns the index of the calling worker, or the worker count if called from outside the pool.
+            size_t current(void) const;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor starting the worker threads.
+             *  @param threads The number of worker threads. 0 uses the hardware concurrency.
+             */
+            TaskPool(const size_t& threads = 0);
+
+            //! Standard destructor. Waits for queued tasks to finish and stops the workers.
+            ~TaskPool(void);
+
+            TaskPool(const TaskPool& other) = delete;
+            TaskPool& operator=(const TaskPool& other) = delete;
+
+            //! Returns the number of worker threads.
+            size_t size(void) const { return mThreads.size(); }
+
+            /**
+             *  @brief Queues a task. Tasks queued from a worker go onto that worker's own queue.
+             *  @param group The group to account the task to.
+             *  @param task The work to do.
+             */
+            void run(Group& group, std::function<void()> task);
+
+            /**
+             *  @brief Waits for every task of a group to finish. The calling thread runs queued tasks in the
+             *  meantime, so waiting from within a task does not tie up a worker.
+             *  @param group The group to wait for.
+             *  @throw Rethrows the first exception thrown by a task of the group.
+             */
+            void wait(Group& group);
+    };
+
+    /**
+     *  @brief Builds the subtables of a Table in parallel. Each subtable is filled by its own task into a
+     *  table that no other task touches, and the finished subtables are attached by the calling thread
+     *  afterwards, so no locking is involved.
+     *
+     *  @code
+     *  EasyLua::BulkTableBuilder builder(pool);
+     *  for (const Region& region : regions)
+     *      builder.add(region.name, [&region](EasyLua::Table& out) { fillRegion(region, out); });
+     *  builder.build(root);
+     *  @endcode
+     */
+    class BulkTableBuilder
+    {
+        // Private Members
+        private:
+            //! The pool the subtables are built on.
+            TaskPool& mPool;
+
+            //! The queued subtables and their fill functions.
+            std::vector<std::pair<std::string, std::function<void(Table&)>>> mSubtables;
+
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param pool The pool to build subtables on.
+             */
+            BulkTableBuilder(TaskPool& pool) : mPool(pool) { }
+
+            /**
+             *  @brief Queues a subtable.
+             *  @param key The key to attach the subtable to.
+             *  @param fill Fills the subtable. It may use its own BulkTableBuilder on the same pool.
+             */
+            void add(const std::string& key, std::function<void(Table&)> fill) { mSubtables.push_back(std::make_pair(key, std::move(fill))); }
+
+            /**
+             *  @brief Builds all queued subtables in parallel and attaches them to the given table, replacing
+             *  anything stored on the same keys. The queue is empty afterwards.
+             *  @param out The table to attach the subtables to.
+             */
+            void build(Table& out);
+    };
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_TASKS_HPP_
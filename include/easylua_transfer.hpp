@@ -0,0 +1,35 @@
+/**
+ *  @file easylua_transfer.hpp
+ *  @brief Include file declaring direct value transfer between Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_TRANSFER_HPP_
+#define _INCLUDE_EASYLUA_TRANSFER_HPP_
+
+#include <easylua.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Copies a value from one state to another without an intermediate EasyLua::Table. Nested tables
+     *  are copied with an explicit work stack, so depth is only limited by the Lua stacks, and every table is
+     *  presized. A table referenced several times is copied once, so shared references and cycles come out
+     *  the same way in the destination. Long strings appearing several times are copied once.
+     *  @param source The state to copy from.
+     *  @param index The stack index of the value to copy.
+     *  @param destination The state to push the copy to.
+     *  @throw std::runtime_error Thrown if the value contains anything but nil, booleans, numbers, strings,
+     *  light userdata and tables, or if a stack cannot grow. Both stacks are left as they were.
+     *  @note Metatables are not copied. Neither state may be in use by another thread during the transfer.
+     */
+    void transfer(lua_State* source, const int& index, lua_State* destination);
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_TRANSFER_HPP_
@@ -10,15 +10,237 @@
  *  @copyright (c) 2016 Robert MacGregor
  */
 
+#include <algorithm>
+#include <memory>
+#include <new>
+
 #include <easylua.hpp>
 
 namespace EasyLua
 {
-    Table::Table(void)
+    /**
+     *  @brief The userdata and metamethods backing Table::pushProxy.
+     */
+    struct TableProxy
+    {
+        //! The registry name of the proxy metatable.
+        static constexpr const char* METATABLE = "EasyLua.TableProxy";
+
+        //! The table being proxied.
+        Table* table;
+
+        //! A registry reference to the lookup cache, or LUA_NOREF when not caching.
+        int cache;
+
+        static void push(lua_State* lua, Table* table, const bool& cache)
+        {
+            TableProxy* proxy = reinterpret_cast<TableProxy*>(lua_newuserdata(lua, sizeof(TableProxy)));
+            proxy->table = table;
+            proxy->cache = LUA_NOREF;
+
+            if (luaL_newmetatable(lua, METATABLE))
+            {
+                static const luaL_Reg metamethods[] = {
+                    { "__index", TableProxy::index },
+                    { "__newindex", TableProxy::newIndex },
+                    { "__len", TableProxy::length },
+                    { "__pairs", TableProxy::pairs },
+                    { "__gc", TableProxy::collect },
+                    { nullptr, nullptr }
+                };
+
+                luaL_setfuncs(lua, metamethods, 0);
+            }
+            lua_setmetatable(lua, -2);
+
+            if (cache)
+            {
+                lua_createtable(lua, 0, 0);
+                proxy->cache = luaL_ref(lua, LUA_REGISTRYINDEX);
+            }
+        }
+
+        /**
+         *  @brief Pushes the value stored on the given key, resolving subtables to proxies.
+         *  @param lua The Lua state to push to.
+         *  @param proxy The proxy being read.
+         *  @param key The key to look up. Its value is expected at stack index 2.
+         */
+        static void pushValue(lua_State* lua, TableProxy* proxy, const std::string& key)
+        {
+            if (proxy->cache != LUA_NOREF)
+            {
+                lua_rawgeti(lua, LUA_REGISTRYINDEX, proxy->cache);
+                lua_pushvalue(lua, 2);
+
+                if (lua_rawget(lua, -2) != LUA_TNIL)
+                {
+                    lua_remove(lua, -2);
+                    return;
+                }
+
+                lua_pop(lua, 1);
+            }
+
+            auto entry = proxy->table->mTypes.find(key);
+
+            if (entry == proxy->table->mTypes.end())
+                lua_pushnil(lua);
+            else if (entry->second.second == EASYLUA_TABLE)
+                TableProxy::push(lua, reinterpret_cast<Table*>(proxy->table->mContents[key]), proxy->cache != LUA_NOREF);
+            else
+                proxy->table->pushValue(lua, entry->second.second, proxy->table->mContents[key], false);
+
+            if (proxy->cache != LUA_NOREF)
+            {
+                // Stack: cache, value
+                lua_pushvalue(lua, 2);
+                lua_pushvalue(lua, -2);
+                lua_rawset(lua, -4);
+                lua_remove(lua, -2);
+            }
+        }
+
+        static int index(lua_State* lua)
+        {
+            TableProxy* proxy = reinterpret_cast<TableProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            if (lua_type(lua, 2) != LUA_TSTRING)
+            {
+                lua_pushnil(lua);
+                return 1;
+            }
+
+            size_t length = 0;
+            const char* key = lua_tolstring(lua, 2, &length);
+
+            TableProxy::pushValue(lua, proxy, std::string(key, length));
+            return 1;
+        }
+
+        static int newIndex(lua_State* lua)
+        {
+            return luaL_error(lua, "Attempted to write to a read-only table proxy!");
+        }
+
+        static int length(lua_State* lua)
+        {
+            TableProxy* proxy = reinterpret_cast<TableProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            lua_pushinteger(lua, static_cast<lua_Integer>(proxy->table->mTypes.size()));
+            return 1;
+        }
+
+        static int next(lua_State* lua)
+        {
+            TableProxy* proxy = reinterpret_cast<TableProxy*>(luaL_checkudata(lua, 1, METATABLE));
+            auto& types = proxy->table->mTypes;
+            auto it = types.begin();
+
+            if (!lua_isnil(lua, 2))
+            {
+                size_t length = 0;
+                const char* key = luaL_checklstring(lua, 2, &length);
+
+                it = types.find(std::string(key, length));
+                if (it == types.end())
+                    return luaL_error(lua, "Invalid key to 'next' on a table proxy!");
+
+                ++it;
+            }
+
+            if (it == types.end())
+            {
+                lua_pushnil(lua);
+                return 1;
+            }
+
+            lua_settop(lua, 1);
+            lua_pushlstring(lua, it->first.data(), it->first.size());
+            TableProxy::pushValue(lua, proxy, it->first);
+            return 2;
+        }
+
+        static int pairs(lua_State* lua)
+        {
+            luaL_checkudata(lua, 1, METATABLE);
+
+            lua_pushcfunction(lua, TableProxy::next);
+            lua_pushvalue(lua, 1);
+            lua_pushnil(lua);
+            return 3;
+        }
+
+        static int collect(lua_State* lua)
+        {
+            TableProxy* proxy = reinterpret_cast<TableProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            if (proxy->cache != LUA_NOREF)
+                luaL_unref(lua, LUA_REGISTRYINDEX, proxy->cache);
+            proxy->cache = LUA_NOREF;
+
+            return 0;
+        }
+    };
+
+    /**
+     *  @brief A userdata anchored in the registry of every state tables are synced to. It is only collected
+     *  when the state closes, at which point it marks the state as closed for every table still synced to it.
+     */
+    struct SyncAnchor
+    {
+        //! The registry name of the anchor metatable.
+        static constexpr const char* METATABLE = "EasyLua.SyncAnchor";
+
+        //! Whether the state is open, shared with every table synced to it.
+        std::shared_ptr<bool> open;
+
+        /**
+         *  @brief Returns the flag telling whether the given state is open, anchoring it first if necessary.
+         *  @param lua The state tables are synced to.
+         */
+        static std::shared_ptr<bool> get(lua_State* lua)
+        {
+            static const char key = 0;
+
+            if (lua_rawgetp(lua, LUA_REGISTRYINDEX, &key) == LUA_TUSERDATA)
+            {
+                std::shared_ptr<bool> result = reinterpret_cast<SyncAnchor*>(lua_touserdata(lua, -1))->open;
+                lua_pop(lua, 1);
+
+                return result;
+            }
+
+            lua_pop(lua, 1);
+
+            SyncAnchor* anchor = new (lua_newuserdata(lua, sizeof(SyncAnchor))) SyncAnchor { std::make_shared<bool>(true) };
+            std::shared_ptr<bool> result = anchor->open;
+
+            if (luaL_newmetatable(lua, METATABLE))
+            {
+                lua_pushcfunction(lua, SyncAnchor::collect);
+                lua_setfield(lua, -2, "__gc");
+            }
+            lua_setmetatable(lua, -2);
+
+            lua_rawsetp(lua, LUA_REGISTRYINDEX, &key);
+            return result;
+        }
+
+        static int collect(lua_State* lua)
+        {
+            SyncAnchor* anchor = reinterpret_cast<SyncAnchor*>(lua_touserdata(lua, 1));
+            *anchor->open = false;
+            anchor->~SyncAnchor();
+            return 0;
+        }
+    };
+
+    Table::Table(void) : mSyncState(nullptr), mSyncReference(LUA_NOREF), mFrozen(false)
     {
     }
 
-    Table::Table(Table& other)
+    Table::Table(Table& other) : mSyncState(nullptr), mSyncReference(LUA_NOREF), mFrozen(false)
     {
         this->clear(true);
         this->copy(other);
@@ -26,11 +248,17 @@ namespace EasyLua
 
     Table::~Table(void)
     {
+        // The reference went away with the state if it was closed first
+        if (mSyncState && mSyncReference != LUA_NOREF && *mSyncOpen)
+            luaL_unref(mSyncState, LUA_REGISTRYINDEX, mSyncReference);
+
         this->clear(true);
     }
 
     void Table::clear(bool deleteChildren)
     {
+        this->unfreeze();
+
         for (auto it = mTypes.begin(); it != mTypes.end(); it++)
         {
             auto current = *it;
@@ -67,7 +295,57 @@ namespace EasyLua
                     break;
                 }
             }
+
+            mDirtyKeys.insert(name);
+        }
+
+        mTables.clear();
+        mContents.clear();
+        mTypes.clear();
+    }
+
+    void Table::erase(const std::string& key)
+    {
+        auto it = mTypes.find(key);
+        if (it == mTypes.end())
+            return;
+
+        void* erasedMemory = mContents[key];
+
+        switch (it->second.second)
+        {
+            case EASYLUA_FLOAT:
+            {
+                delete reinterpret_cast<float*>(erasedMemory);
+                break;
+            }
+
+            case EASYLUA_INTEGER:
+            {
+                delete reinterpret_cast<int*>(erasedMemory);
+                break;
+            }
+
+            case EASYLUA_STRING:
+            {
+                delete reinterpret_cast<std::string*>(erasedMemory);
+                break;
+            }
         }
+
+        mTables.erase(key);
+        mContents.erase(key);
+        mTypes.erase(it);
+    }
+
+    void Table::remove(const std::string& key)
+    {
+        if (mTypes.count(key) == 0)
+            return;
+
+        this->unfreeze();
+        this->erase(key);
+        mDirtyKeys.insert(key);
     }
 
     template <>
@@ -96,6 +374,18 @@ namespace EasyLua
 
     void Table::copy(Table& other)
     {
+        this->copyFrom(other, nullptr);
+    }
+
+    void Table::copyFrom(Table& other, std::vector<std::pair<Table*, Table*>>* subtables)
+    {
+        this->unfreeze();
+
+        // Everything we held before is going away
+        for (auto it = mTypes.begin(); it != mTypes.end(); it++)
+            mDirtyKeys.insert(it->first);
+
+        mTables.clear();
         mTypes.clear();
         mContents.clear();
 
@@ -139,8 +429,14 @@ namespace EasyLua
                 case EASYLUA_TABLE:
                 {
                     Table* newTable = new Table();
-                    newTable->copy(*reinterpret_cast<Table*>(copiedMemory));
+
+                    if (subtables)
+                        subtables->push_back(std::make_pair(newTable, reinterpret_cast<Table*>(copiedMemory)));
+                    else
+                        newTable->copy(*reinterpret_cast<Table*>(copiedMemory));
+
                     newMemory = newTable;
+                    mTables[name] = newTable;
 
                     break;
                 }
@@ -150,55 +446,372 @@ namespace EasyLua
 
             mContents[name] = newMemory;
             mTypes[name] = std::make_pair(name, type);
+            mDirtyKeys.insert(name);
+        }
+    }
+
+    void Table::pushValue(lua_State* lua, const unsigned char& type, void* memory, const bool& sync)
+    {
+        switch (type)
+        {
+            case EasyLua::EASYLUA_FLOAT:
+            {
+                lua_pushnumber(lua, *reinterpret_cast<float*>(memory));
+                break;
+            }
+
+            case EasyLua::EASYLUA_STRING:
+            {
+                const std::string* value = reinterpret_cast<std::string*>(memory);
+                lua_pushlstring(lua, value->data(), value->size());
+                break;
+            }
+
+            case EasyLua::EASYLUA_INTEGER:
+            {
+                lua_pushinteger(lua, *reinterpret_cast<int*>(memory));
+                break;
+            }
+
+            case EasyLua::EASYLUA_TABLE:
+            {
+                if (sync)
+                    reinterpret_cast<Table*>(memory)->sync(lua);
+                else
+                    reinterpret_cast<Table*>(memory)->push(lua);
+                break;
+            }
         }
     }
 
     void Table::push(lua_State* lua)
     {
-        lua_createtable(lua, 0, 0);
+        lua_createtable(lua, 0, static_cast<int>(mTypes.size()));
 
         for (auto it = mTypes.begin(); it != mTypes.end(); it++)
         {
-            const std::string name = (*it).first;
-            auto current = (*it).second;
+            const std::string& name = (*it).first;
 
-            lua_pushstring(lua, current.first.data());
+            lua_pushlstring(lua, name.data(), name.size());
+            this->pushValue(lua, (*it).second.second, mContents[name], false);
+            lua_settable(lua, -3);
+        }
+    }
 
-            switch (current.second)
-            {
-                case EasyLua::EASYLUA_FLOAT:
-                {
-                    lua_pushnumber(lua, *reinterpret_cast<float*>(mContents[name]));
-                    break;
-                }
+    void Table::sync(lua_State* lua)
+    {
+        if (!this->isSyncedTo(lua))
+        {
+            // Only one state is tracked, so drop the reference held in the previous one if it is still open
+            if (mSyncState && mSyncReference != LUA_NOREF && *mSyncOpen)
+                luaL_unref(mSyncState, LUA_REGISTRYINDEX, mSyncReference);
 
-                case EasyLua::EASYLUA_STRING:
-                {
-                    lua_pushstring(lua, reinterpret_cast<std::string*>(mContents[name])->data());
-                    break;
-                }
+            // Nothing to reuse in this state, so build the entire table and keep a reference to it
+            lua_createtable(lua, 0, static_cast<int>(mTypes.size()));
 
-                case EasyLua::EASYLUA_INTEGER:
-                {
-                    lua_pushinteger(lua, *reinterpret_cast<int*>(mContents[name]));
-                    break;
-                }
+            for (auto it = mTypes.begin(); it != mTypes.end(); it++)
+            {
+                const std::string& name = (*it).first;
 
-                case EasyLua::EASYLUA_TABLE:
-                {
-                    mTables[name]->push(lua);
-                    break;
-                }
+                lua_pushlstring(lua, name.data(), name.size());
+                this->pushValue(lua, (*it).second.second, mContents[name], true);
+                lua_rawset(lua, -3);
             }
 
-            lua_settable(lua, -3);
+            lua_pushvalue(lua, -1);
+            mSyncReference = luaL_ref(lua, LUA_REGISTRYINDEX);
+            mSyncOpen = SyncAnchor::get(lua);
+            mSyncState = lua;
+            mDirtyKeys.clear();
+            return;
+        }
+
+        lua_rawgeti(lua, LUA_REGISTRYINDEX, mSyncReference);
+
+        for (auto it = mDirtyKeys.begin(); it != mDirtyKeys.end(); it++)
+        {
+            const std::string& name = *it;
+            auto current = mTypes.find(name);
+
+            lua_pushlstring(lua, name.data(), name.size());
+
+            if (current == mTypes.end())
+                lua_pushnil(lua);
+            else
+                this->pushValue(lua, current->second.second, mContents[name], true);
+
+            lua_rawset(lua, -3);
+        }
+
+        // Subtables that were not replaced are still referenced by our Lua table, so only changes within them matter
+        for (auto it = mTables.begin(); it != mTables.end(); it++)
+        {
+            Table* child = it->second;
+
+            if (mDirtyKeys.count(it->first) != 0 || !child->isDirty())
+                continue;
+
+            const bool attached = child->isSyncedTo(lua);
+            child->sync(lua);
+
+            if (attached)
+                lua_pop(lua, 1);
+            else
+                lua_setfield(lua, -2, it->first.c_str());
         }
+
+        mDirtyKeys.clear();
+    }
+
+    void Table::pushProxy(lua_State* lua, const bool& cache)
+    {
+        TableProxy::push(lua, this, cache);
+    }
+
+    void Table::release(lua_State* lua)
+    {
+        if (this->isSyncedTo(lua))
+            luaL_unref(lua, LUA_REGISTRYINDEX, mSyncReference);
+
+        mSyncState = nullptr;
+        mSyncReference = LUA_NOREF;
+        mSyncOpen.reset();
+
+        for (auto it = mTables.begin(); it != mTables.end(); it++)
+            it->second->release(lua);
+    }
+
+    bool Table::isDirty(void) const
+    {
+        if (!mDirtyKeys.empty() || mSyncReference == LUA_NOREF || !*mSyncOpen)
+            return true;
+
+        for (auto it = mTables.begin(); it != mTables.end(); it++)
+            if (it->second->isDirty())
+                return true;
+
+        return false;
     }
 
     void Table::setTable(const std::string& key, Table& value)
     {
+        this->unfreeze();
+        this->erase(key);
+
         mTables[key] = &value;
         mTypes[key] = std::make_pair(key, EasyLua::EASYLUA_TABLE);
         mContents[key] = &value;
+        mDirtyKeys.insert(key);
+    }
+
+    /**
+     *  @brief Mixes a key hash with a bucket seed to produce a slot candidate.
+     *  @param hash The key hash.
+     *  @param seed The displacement seed of the key's bucket.
+     *  @return The mixed hash.
+     */
+    static inline uint64_t mixFrozenKey(uint64_t hash, const uint64_t& seed)
+    {
+        // SplitMix64 finalizer
+        hash ^= seed * 0x9E3779B97F4A7C15ULL;
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+        return hash ^ (hash >> 31);
+    }
+
+    void Table::freeze(void)
+    {
+        // Keys are hashed into small buckets, then each bucket searches for a seed that places all of
+        // its keys into free slots (hash and displace). Larger buckets go first while slots are plentiful.
+        static const uint64_t MAXIMUM_SEED = 1 << 24;
+
+        this->unfreeze();
+
+        const size_t count = mTypes.size();
+        const size_t bucketCount = count / 4 + 1;
+
+        std::vector<std::vector<std::pair<uint64_t, decltype(mTypes)::iterator>>> buckets(bucketCount);
+        for (auto it = mTypes.begin(); it != mTypes.end(); it++)
+        {
+            const uint64_t hash = EasyLua::Utilities::hashKey(it->first);
+            buckets[(hash >> 32) % bucketCount].push_back(std::make_pair(hash, it));
+        }
+
+        std::vector<size_t> order(bucketCount);
+        for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+            order[bucket] = bucket;
+        std::sort(order.begin(), order.end(), [&buckets](const size_t& lhs, const size_t& rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+        std::vector<uint64_t> seeds(bucketCount, 0);
+        std::vector<FrozenEntry> entries(count, FrozenEntry { nullptr, 0, nullptr });
+        std::vector<size_t> slots;
+
+        for (auto it = order.begin(); it != order.end(); it++)
+        {
+            const auto& bucket = buckets[*it];
+            if (bucket.empty())
+                break;
+
+            uint64_t seed = 0;
+            for (; seed < MAXIMUM_SEED; ++seed)
+            {
+                slots.clear();
+
+                for (auto key = bucket.begin(); key != bucket.end(); key++)
+                {
+                    const size_t slot = mixFrozenKey((*key).first, seed) % count;
+
+                    if (entries[slot].key || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                        break;
+                    slots.push_back(slot);
+                }
+
+                if (slots.size() == bucket.size())
+                    break;
+            }
+
+            if (seed == MAXIMUM_SEED)
+                throw std::runtime_error("Unable to find a perfect hash for the table keys!");
+
+            seeds[*it] = seed;
+            for (size_t key = 0; key < bucket.size(); ++key)
+            {
+                auto entry = bucket[key].second;
+                entries[slots[key]] = FrozenEntry { &entry->first, entry->second.second, mContents[entry->first] };
+            }
+        }
+
+        mFrozenSeeds = std::move(seeds);
+        mFrozenEntries = std::move(entries);
+        mFrozen = true;
+    }
+
+    void Table::unfreeze(void)
+    {
+        if (!mFrozen)
+            return;
+
+        mFrozen = false;
+        mFrozenSeeds.clear();
+        mFrozenEntries.clear();
+    }
+
+    const Table::FrozenEntry* Table::findFrozen(const std::string& key) const
+    {
+        if (mFrozenEntries.empty())
+            return nullptr;
+
+        const uint64_t hash = EasyLua::Utilities::hashKey(key);
+        const uint64_t seed = mFrozenSeeds[(hash >> 32) % mFrozenSeeds.size()];
+        const FrozenEntry& entry = mFrozenEntries[mixFrozenKey(hash, seed) % mFrozenEntries.size()];
+
+        return *entry.key == key ? &entry : nullptr;
+    }
+
+    TablePushJob::TablePushJob(lua_State* lua, Table& table) : mLua(lua), mResult(LUA_NOREF), mConverted(0)
+    {
+        lua_createtable(lua, 0, static_cast<int>(table.mTypes.size()));
+        mResult = luaL_ref(lua, LUA_REGISTRYINDEX);
+
+        mFrames.push_back({ &table, table.mTypes.begin(), mResult });
+    }
+
+    TablePushJob::~TablePushJob(void)
+    {
+        for (auto it = mFrames.begin(); it != mFrames.end(); it++)
+            if ((*it).reference != mResult)
+                luaL_unref(mLua, LUA_REGISTRYINDEX, (*it).reference);
+
+        luaL_unref(mLua, LUA_REGISTRYINDEX, mResult);
+    }
+
+    bool TablePushJob::step(const size_t& entries)
+    {
+        return this->advance(entries, std::chrono::steady_clock::time_point(), false);
+    }
+
+    bool TablePushJob::step(const std::chrono::nanoseconds& budget)
+    {
+        return this->advance(SIZE_MAX, std::chrono::steady_clock::now() + budget, true);
+    }
+
+    bool TablePushJob::advance(size_t entries, const std::chrono::steady_clock::time_point& deadline, const bool& timed)
+    {
+        // Reading the clock for every entry would cost more than the entries themselves
+        static const size_t CLOCK_INTERVAL = 64;
+
+        if (mFrames.empty())
+            return true;
+
+        if (!lua_checkstack(mLua, 4))
+            throw std::runtime_error("Unable to grow the Lua stack!");
+
+        lua_rawgeti(mLua, LUA_REGISTRYINDEX, mFrames.back().reference);
+
+        for (size_t iteration = 1; entries != 0; ++iteration)
+        {
+            Frame& frame = mFrames.back();
+
+            if (frame.current == frame.table->mTypes.end())
+            {
+                // This table is done, so resume its parent
+                lua_pop(mLua, 1);
+
+                if (frame.reference != mResult)
+                    luaL_unref(mLua, LUA_REGISTRYINDEX, frame.reference);
+                mFrames.pop_back();
+
+                if (mFrames.empty())
+                    return true;
+
+                lua_rawgeti(mLua, LUA_REGISTRYINDEX, mFrames.back().reference);
+                continue;
+            }
+
+            const std::string& name = frame.current->first;
+            const unsigned char type = frame.current->second.second;
+            void* memory = frame.table->mContents[name];
+            ++frame.current;
+
+            lua_pushlstring(mLua, name.data(), name.size());
+
+            if (type == EASYLUA_TABLE)
+            {
+                Table* child = reinterpret_cast<Table*>(memory);
+
+                // Attach the new table to its parent right away so that only the frame needs to hold a reference
+                lua_createtable(mLua, 0, static_cast<int>(child->mTypes.size()));
+                lua_pushvalue(mLua, -1);
+                const int reference = luaL_ref(mLua, LUA_REGISTRYINDEX);
+                lua_pushvalue(mLua, -1);
+                lua_insert(mLua, -3);
+                lua_rawset(mLua, -4);
+                lua_remove(mLua, -2);
+
+                mFrames.push_back({ child, child->mTypes.begin(), reference });
+            }
+            else
+            {
+                frame.table->pushValue(mLua, type, memory, false);
+                lua_rawset(mLua, -3);
+            }
+
+            ++mConverted;
+            --entries;
+
+            if (timed && iteration % CLOCK_INTERVAL == 0 && std::chrono::steady_clock::now() >= deadline)
+                break;
+        }
+
+        lua_pop(mLua, 1);
+        return mFrames.empty();
+    }
+
+    void TablePushJob::push(void)
+    {
+        if (!mFrames.empty())
+            throw std::runtime_error("Attempted to push an incomplete table!");
+
+        lua_rawgeti(mLua, LUA_REGISTRYINDEX, mResult);
     }
 }
@@ -0,0 +1,544 @@
+/**
+ *  @file easylua_arrays.cpp
+ *  @brief Source file implementing typed array userdata and their vectorized kernels.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <cstring>
+#include <new>
+
+#include <easylua_arrays.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EASYLUA_KERNELS_SSE2
+
+    #include <emmintrin.h>
+#endif
+
+#include "easylua_kernels.hpp"
+
+namespace EasyLua
+{
+    namespace Kernels
+    {
+#ifdef EASYLUA_KERNELS_SSE2
+        namespace
+        {
+            //! Four float lanes.
+            struct Sse2Float32
+            {
+                typedef float scalar;
+                typedef __m128 vector;
+                typedef __m128 accumulator;
+                typedef double total;
+
+                static constexpr size_t width = 4;
+
+                static inline vector load(const scalar* data) { return _mm_loadu_ps(data); }
+                static inline void store(scalar* data, const vector& value) { _mm_storeu_ps(data, value); }
+                static inline vector broadcast(const scalar& value) { return _mm_set1_ps(value); }
+                static inline accumulator zero(void) { return _mm_setzero_ps(); }
+
+                static inline vector add(const vector& first, const vector& second) { return _mm_add_ps(first, second); }
+                static inline vector multiply(const vector& first, const vector& second) { return _mm_mul_ps(first, second); }
+                static inline vector minimum(const vector& first, const vector& second) { return _mm_min_ps(first, second); }
+                static inline vector maximum(const vector& first, const vector& second) { return _mm_max_ps(first, second); }
+
+                static inline accumulator accumulate(const accumulator& sum, const vector& value) { return _mm_add_ps(sum, value); }
+                static inline accumulator multiplyAccumulate(const accumulator& sum, const vector& first, const vector& second) { return _mm_add_ps(sum, _mm_mul_ps(first, second)); }
+
+                static inline total reduce(const accumulator& sum)
+                {
+                    float values[width];
+                    _mm_storeu_ps(values, sum);
+                    return (static_cast<total>(values[0]) + values[1]) + (static_cast<total>(values[2]) + values[3]);
+                }
+
+                static inline vector scan(vector value)
+                {
+                    value = _mm_add_ps(value, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(value), 4)));
+                    return _mm_add_ps(value, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(value), 8)));
+                }
+
+                static inline vector broadcastLast(const vector& value) { return _mm_shuffle_ps(value, value, 0xFF); }
+            };
+
+            //! Two double lanes.
+            struct Sse2Float64
+            {
+                typedef double scalar;
+                typedef __m128d vector;
+                typedef __m128d accumulator;
+                typedef double total;
+
+                static constexpr size_t width = 2;
+
+                static inline vector load(const scalar* data) { return _mm_loadu_pd(data); }
+                static inline void store(scalar* data, const vector& value) { _mm_storeu_pd(data, value); }
+                static inline vector broadcast(const scalar& value) { return _mm_set1_pd(value); }
+                static inline accumulator zero(void) { return _mm_setzero_pd(); }
+
+                static inline vector add(const vector& first, const vector& second) { return _mm_add_pd(first, second); }
+                static inline vector multiply(const vector& first, const vector& second) { return _mm_mul_pd(first, second); }
+                static inline vector minimum(const vector& first, const vector& second) { return _mm_min_pd(first, second); }
+                static inline vector maximum(const vector& first, const vector& second) { return _mm_max_pd(first, second); }
+
+                static inline accumulator accumulate(const accumulator& sum, const vector& value) { return _mm_add_pd(sum, value); }
+                static inline accumulator multiplyAccumulate(const accumulator& sum, const vector& first, const vector& second) { return _mm_add_pd(sum, _mm_mul_pd(first, second)); }
+
+                static inline total reduce(const accumulator& sum)
+                {
+                    double values[width];
+                    _mm_storeu_pd(values, sum);
+                    return values[0] + values[1];
+                }
+
+                static inline vector scan(const vector& value) { return _mm_add_pd(value, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(value), 8))); }
+
+                static inline vector broadcastLast(const vector& value) { return _mm_unpackhi_pd(value, value); }
+            };
+        }
+#endif
+    }
+
+    /**
+     *  @brief The kernels every typed array operation dispatches to.
+     */
+    struct TypedArrayKernels
+    {
+        Kernels::Float32Kernels float32;
+        Kernels::Float64Kernels float64;
+        Kernels::Int32Kernels int32;
+
+        //! The instruction set the kernels were chosen for.
+        TypedArray::KernelLevel level;
+
+        /**
+         *  @brief Chooses the best kernels supported by the CPU.
+         *  @param limit The highest instruction set to consider.
+         */
+        static TypedArrayKernels select(const TypedArray::KernelLevel& limit)
+        {
+            TypedArrayKernels result;
+            Kernels::Loops<Kernels::ScalarLanes<float, double>>::install(result.float32);
+            Kernels::Loops<Kernels::ScalarLanes<double, double>>::install(result.float64);
+            Kernels::Loops<Kernels::ScalarLanes<int32_t, int64_t>>::install(result.int32);
+            result.level = TypedArray::KERNELS_SCALAR;
+
+#ifdef EASYLUA_KERNELS_SSE2
+            if (limit >= TypedArray::KERNELS_SSE2)
+            {
+                Kernels::Loops<Kernels::Sse2Float32>::install(result.float32);
+                Kernels::Loops<Kernels::Sse2Float64>::install(result.float64);
+                result.level = TypedArray::KERNELS_SSE2;
+            }
+#endif
+
+            if (limit >= TypedArray::KERNELS_AVX2 && Kernels::installAvx2(result.float32, result.float64, result.int32))
+                result.level = TypedArray::KERNELS_AVX2;
+
+            return result;
+        }
+
+        //! Returns the kernels in use.
+        static TypedArrayKernels& active(void)
+        {
+            static TypedArrayKernels sActive = TypedArrayKernels::select(TypedArray::KERNELS_AVX2);
+            return sActive;
+        }
+    };
+
+    /**
+     *  @brief The Lua functions and metamethods backing typed arrays.
+     */
+    struct TypedArrayLibrary
+    {
+        //! The largest number of elements a script may request.
+        static constexpr lua_Integer MAXIMUM_LENGTH = static_cast<lua_Integer>(1) << 40;
+
+        //! Returns the typed array at the given argument, raising a Lua error otherwise.
+        static TypedArray* check(lua_State* lua, const int& argument)
+        {
+            return reinterpret_cast<TypedArray*>(luaL_checkudata(lua, argument, TypedArray::METATABLE));
+        }
+
+        //! Reads a script provided element value, raising a Lua error when it is not a number.
+        template <typename scalar>
+        static scalar checkScalar(lua_State* lua, const int& argument)
+        {
+            if constexpr (std::is_integral<scalar>::value)
+                return static_cast<scalar>(luaL_checkinteger(lua, argument));
+            else
+                return static_cast<scalar>(luaL_checknumber(lua, argument));
+        }
+
+        /**
+         *  @brief Invokes the function with the elements of the array and the kernels for their type.
+         *  @param array The array to dispatch on.
+         *  @param function The function to invoke, accepting a pointer to the elements and a kernel set.
+         *  @return The result of the function.
+         */
+        template <typename functionType>
+        static int dispatch(TypedArray* array, functionType&& function)
+        {
+            TypedArrayKernels& kernels = TypedArrayKernels::active();
+
+            switch (array->type())
+            {
+                case TypedArray::FLOAT32:
+                    return function(array->data<float>(), kernels.float32);
+                case TypedArray::FLOAT64:
+                    return function(array->data<double>(), kernels.float64);
+                default:
+                    return function(array->data<int32_t>(), kernels.int32);
+            }
+        }
+
+        //! Raises a Lua error unless both arrays have the same element type and length.
+        static void checkMatching(lua_State* lua, TypedArray* array, TypedArray* other, const int& argument)
+        {
+            luaL_argcheck(lua, other->type() == array->type(), argument, "mismatched typed array element types");
+            luaL_argcheck(lua, other->length() == array->length(), argument, "mismatched typed array lengths");
+        }
+
+        static const char* typeName(const TypedArray::Type& type)
+        {
+            switch (type)
+            {
+                case TypedArray::FLOAT32:
+                    return "float32";
+                case TypedArray::FLOAT64:
+                    return "float64";
+                default:
+                    return "int32";
+            }
+        }
+
+        static int index(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            int isInteger = 0;
+            const lua_Integer position = lua_tointegerx(lua, 2, &isInteger);
+
+            if (isInteger)
+            {
+                if (position < 1 || static_cast<lua_Unsigned>(position) > array->length())
+                {
+                    lua_pushnil(lua);
+                    return 1;
+                }
+
+                return TypedArrayLibrary::dispatch(array, [lua, position](auto* data, auto& kernels) {
+                    EasyLua::Utilities::pushParameters(lua, data[position - 1]);
+                    return 1;
+                });
+            }
+
+            // Everything else is looked up in the method table
+            lua_pushvalue(lua, 2);
+            lua_rawget(lua, lua_upvalueindex(1));
+            return 1;
+        }
+
+        static int newIndex(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            int isInteger = 0;
+            const lua_Integer position = lua_tointegerx(lua, 2, &isInteger);
+
+            if (!isInteger || position < 1 || static_cast<lua_Unsigned>(position) > array->length())
+                return luaL_error(lua, "Typed array index out of range!");
+
+            return TypedArrayLibrary::dispatch(array, [lua, position](auto* data, auto& kernels) {
+                data[position - 1] = TypedArrayLibrary::checkScalar<std::remove_pointer_t<decltype(data)>>(lua, 3);
+                return 0;
+            });
+        }
+
+        static int length(lua_State* lua)
+        {
+            lua_pushinteger(lua, static_cast<lua_Integer>(TypedArrayLibrary::check(lua, 1)->length()));
+            return 1;
+        }
+
+        static int toString(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            lua_pushfstring(lua, "TypedArray(%s, %d)", TypedArrayLibrary::typeName(array->type()), static_cast<int>(array->length()));
+            return 1;
+        }
+
+        static int type(lua_State* lua)
+        {
+            lua_pushstring(lua, TypedArrayLibrary::typeName(TypedArrayLibrary::check(lua, 1)->type()));
+            return 1;
+        }
+
+        static int sum(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            return TypedArrayLibrary::dispatch(array, [lua, array](auto* data, auto& kernels) {
+                EasyLua::Utilities::pushParameters(lua, kernels.sum(data, array->length()));
+                return 1;
+            });
+        }
+
+        template <bool greatest>
+        static int extreme(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            if (array->length() == 0)
+            {
+                lua_pushnil(lua);
+                return 1;
+            }
+
+            return TypedArrayLibrary::dispatch(array, [lua, array](auto* data, auto& kernels) {
+                EasyLua::Utilities::pushParameters(lua, greatest ? kernels.maximum(data, array->length()) : kernels.minimum(data, array->length()));
+                return 1;
+            });
+        }
+
+        static int dot(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+            TypedArray* other = TypedArrayLibrary::check(lua, 2);
+            TypedArrayLibrary::checkMatching(lua, array, other, 2);
+
+            return TypedArrayLibrary::dispatch(array, [lua, array, other](auto* data, auto& kernels) {
+                typedef std::remove_pointer_t<decltype(data)> scalar;
+
+                EasyLua::Utilities::pushParameters(lua, kernels.dot(data, other->template data<scalar>(), array->length()));
+                return 1;
+            });
+        }
+
+        static int axpy(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+            TypedArray* x = TypedArrayLibrary::check(lua, 3);
+            TypedArrayLibrary::checkMatching(lua, array, x, 3);
+
+            TypedArrayLibrary::dispatch(array, [lua, array, x](auto* data, auto& kernels) {
+                typedef std::remove_pointer_t<decltype(data)> scalar;
+
+                kernels.axpy(TypedArrayLibrary::checkScalar<scalar>(lua, 2), x->template data<scalar>(), data, array->length());
+                return 0;
+            });
+
+            lua_settop(lua, 1);
+            return 1;
+        }
+
+        static int scale(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            TypedArrayLibrary::dispatch(array, [lua, array](auto* data, auto& kernels) {
+                typedef std::remove_pointer_t<decltype(data)> scalar;
+
+                kernels.scale(TypedArrayLibrary::checkScalar<scalar>(lua, 2), data, array->length());
+                return 0;
+            });
+
+            lua_settop(lua, 1);
+            return 1;
+        }
+
+        static int clamp(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            TypedArrayLibrary::dispatch(array, [lua, array](auto* data, auto& kernels) {
+                typedef std::remove_pointer_t<decltype(data)> scalar;
+
+                const scalar low = TypedArrayLibrary::checkScalar<scalar>(lua, 2);
+                const scalar high = TypedArrayLibrary::checkScalar<scalar>(lua, 3);
+                luaL_argcheck(lua, !(high < low), 3, "upper bound is below the lower bound");
+
+                kernels.clamp(low, high, data, array->length());
+                return 0;
+            });
+
+            lua_settop(lua, 1);
+            return 1;
+        }
+
+        static int prefixSum(lua_State* lua)
+        {
+            TypedArray* array = TypedArrayLibrary::check(lua, 1);
+
+            TypedArrayLibrary::dispatch(array, [array](auto* data, auto& kernels) {
+                kernels.prefixSum(data, array->length());
+                return 0;
+            });
+
+            lua_settop(lua, 1);
+            return 1;
+        }
+
+        template <TypedArray::Type type>
+        static int construct(lua_State* lua)
+        {
+            if (lua_type(lua, 1) != LUA_TTABLE)
+            {
+                const lua_Integer length = luaL_checkinteger(lua, 1);
+                luaL_argcheck(lua, length >= 0 && length <= MAXIMUM_LENGTH, 1, "invalid typed array length");
+
+                TypedArray::create(lua, type, static_cast<size_t>(length));
+                return 1;
+            }
+
+            // Copy the sequence of numbers
+            const size_t length = lua_rawlen(lua, 1);
+            TypedArray* array = TypedArray::create(lua, type, length);
+
+            return TypedArrayLibrary::dispatch(array, [lua, length](auto* data, auto& kernels) {
+                typedef std::remove_pointer_t<decltype(data)> scalar;
+
+                for (size_t position = 0; position < length; ++position)
+                {
+                    lua_rawgeti(lua, 1, static_cast<lua_Integer>(position + 1));
+
+                    int isNumber = 0;
+                    if constexpr (std::is_integral<scalar>::value)
+                        data[position] = static_cast<scalar>(lua_tointegerx(lua, -1, &isNumber));
+                    else
+                        data[position] = static_cast<scalar>(lua_tonumberx(lua, -1, &isNumber));
+
+                    if (!isNumber)
+                        return luaL_error(lua, "Typed array element %d is not a valid %s!", static_cast<int>(position + 1), TypedArrayLibrary::typeName(type));
+
+                    lua_pop(lua, 1);
+                }
+
+                return 1;
+            });
+        }
+    };
+
+    TypedArray* TypedArray::allocate(lua_State* lua, const Type& type, const size_t& length, void* data)
+    {
+        // Owned elements are placed after the header, aligned for the widest vector loads
+        static const uintptr_t ALIGNMENT = 32;
+
+        const bool owned = data == nullptr;
+        const size_t elementSize = type == FLOAT64 ? sizeof(double) : sizeof(float);
+        const size_t bytes = owned ? sizeof(TypedArray) + ALIGNMENT + length * elementSize : sizeof(TypedArray);
+
+        void* memory = lua_newuserdata(lua, bytes);
+
+        if (owned)
+        {
+            const uintptr_t elements = (reinterpret_cast<uintptr_t>(memory) + sizeof(TypedArray) + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+            data = reinterpret_cast<void*>(elements);
+            memset(data, 0x00, length * elementSize);
+        }
+
+        TypedArray* array = new (memory) TypedArray(data, length, type, owned);
+
+        if (luaL_newmetatable(lua, METATABLE))
+        {
+            static const luaL_Reg methods[] = {
+                { "type", TypedArrayLibrary::type },
+                { "sum", TypedArrayLibrary::sum },
+                { "min", TypedArrayLibrary::extreme<false> },
+                { "max", TypedArrayLibrary::extreme<true> },
+                { "dot", TypedArrayLibrary::dot },
+                { "axpy", TypedArrayLibrary::axpy },
+                { "scale", TypedArrayLibrary::scale },
+                { "clamp", TypedArrayLibrary::clamp },
+                { "prefixSum", TypedArrayLibrary::prefixSum },
+                { nullptr, nullptr }
+            };
+
+            static const luaL_Reg metamethods[] = {
+                { "__newindex", TypedArrayLibrary::newIndex },
+                { "__len", TypedArrayLibrary::length },
+                { "__tostring", TypedArrayLibrary::toString },
+                { nullptr, nullptr }
+            };
+
+            luaL_setfuncs(lua, metamethods, 0);
+
+            // __index resolves numeric keys to elements and everything else through the method table
+            lua_createtable(lua, 0, sizeof(methods) / sizeof(methods[0]) - 1);
+            luaL_setfuncs(lua, methods, 0);
+            lua_pushcclosure(lua, TypedArrayLibrary::index, 1);
+            lua_setfield(lua, -2, "__index");
+        }
+        lua_setmetatable(lua, -2);
+
+        return array;
+    }
+
+    void TypedArray::open(lua_State* lua)
+    {
+        static const luaL_Reg constructors[] = {
+            { "float32", TypedArrayLibrary::construct<FLOAT32> },
+            { "float64", TypedArrayLibrary::construct<FLOAT64> },
+            { "int32", TypedArrayLibrary::construct<INT32> },
+            { nullptr, nullptr }
+        };
+
+        lua_createtable(lua, 0, sizeof(constructors) / sizeof(constructors[0]) - 1);
+        luaL_setfuncs(lua, constructors, 0);
+        lua_setglobal(lua, "TypedArray");
+    }
+
+    TypedArray* TypedArray::create(lua_State* lua, const Type& type, const size_t& length)
+    {
+        return TypedArray::allocate(lua, type, length, nullptr);
+    }
+
+    TypedArray* TypedArray::borrow(lua_State* lua, float* data, const size_t& length)
+    {
+        return TypedArray::allocate(lua, FLOAT32, length, data);
+    }
+
+    TypedArray* TypedArray::borrow(lua_State* lua, double* data, const size_t& length)
+    {
+        return TypedArray::allocate(lua, FLOAT64, length, data);
+    }
+
+    TypedArray* TypedArray::borrow(lua_State* lua, int32_t* data, const size_t& length)
+    {
+        return TypedArray::allocate(lua, INT32, length, data);
+    }
+
+    TypedArray* TypedArray::get(lua_State* lua, const int& index)
+    {
+        return reinterpret_cast<TypedArray*>(luaL_testudata(lua, index, METATABLE));
+    }
+
+    TypedArray::KernelLevel TypedArray::kernels(void)
+    {
+        return TypedArrayKernels::active().level;
+    }
+
+    TypedArray::KernelLevel TypedArray::useKernels(const KernelLevel& level)
+    {
+        TypedArrayKernels::active() = TypedArrayKernels::select(level);
+        return TypedArrayKernels::active().level;
+    }
+
+    void TypedArray::detach(void)
+    {
+        if (mOwned)
+            throw std::runtime_error("Only borrowed typed arrays may be detached!");
+
+        mData = nullptr;
+        mLength = 0;
+    }
+} // End NameSpace EasyLua
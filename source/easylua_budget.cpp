@@ -0,0 +1,123 @@
+/**
+ *  @file easylua_budget.cpp
+ *  @brief Source file implementing calls bounded by an instruction or time budget.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_budget.hpp>
+
+namespace EasyLua
+{
+    //! Raised as the error value when a budget runs out, so it can be told apart from script errors.
+    static const char sBudgetError = 0;
+
+    void Budget::install(lua_State* lua)
+    {
+        mUsed = 0;
+        mExhausted = false;
+        mDeadline = std::chrono::steady_clock::now() + time;
+
+        mPreviousHook = lua_gethook(lua);
+        mPreviousMask = lua_gethookmask(lua);
+        mPreviousCount = lua_gethookcount(lua);
+
+        // Hooks are per coroutine, so the coroutine itself identifies the budget
+        lua_pushlightuserdata(lua, this);
+        lua_rawsetp(lua, LUA_REGISTRYINDEX, lua);
+
+        lua_sethook(lua, Budget::hook, LUA_MASKCOUNT, granularity);
+    }
+
+    void Budget::uninstall(lua_State* lua)
+    {
+        lua_sethook(lua, mPreviousHook, mPreviousMask, mPreviousCount);
+
+        lua_pushnil(lua);
+        lua_rawsetp(lua, LUA_REGISTRYINDEX, lua);
+    }
+
+    void Budget::hook(lua_State* lua, lua_Debug* debug)
+    {
+        lua_rawgetp(lua, LUA_REGISTRYINDEX, lua);
+        Budget* budget = reinterpret_cast<Budget*>(lua_touserdata(lua, -1));
+        lua_pop(lua, 1);
+
+        if (!budget)
+            return;
+
+        budget->mUsed += static_cast<uint64_t>(budget->granularity);
+
+        if (!budget->mExhausted)
+        {
+            const bool outOfInstructions = budget->instructions != 0 && budget->mUsed >= budget->instructions;
+            const bool outOfTime = budget->time != std::chrono::nanoseconds::zero() && std::chrono::steady_clock::now() >= budget->mDeadline;
+
+            if (!outOfInstructions && !outOfTime)
+                return;
+
+            budget->mExhausted = true;
+        }
+
+        if (budget->mode == Budget::YIELD && lua_isyieldable(lua))
+        {
+            lua_yield(lua, 0);
+            return;
+        }
+
+        lua_pushlightuserdata(lua, const_cast<char*>(&sBudgetError));
+        lua_error(lua);
+    }
+
+    /**
+     *  @brief Replaces the error value of a call that ran out of budget with a message.
+     *  @param lua The state the call ran in.
+     *  @param budget The budget of the call.
+     *  @param status The status of the call.
+     *  @return The status to report.
+     */
+    static int translateStatus(lua_State* lua, const Budget& budget, const int& status)
+    {
+        if (status == LUA_OK || status == LUA_YIELD || !budget.exhausted() || lua_touserdata(lua, -1) != &sBudgetError)
+            return status;
+
+        lua_pop(lua, 1);
+        lua_pushstring(lua, "Budget exceeded!");
+        return EASYLUA_ERRBUDGET;
+    }
+
+    std::pair<int, size_t> pcall(lua_State* lua, Budget& budget, const EasyLua::ParameterCount& parameterCount)
+    {
+        const int base = lua_gettop(lua) - static_cast<int>(parameterCount) - 1;
+
+        budget.install(lua);
+        int status = lua_pcall(lua, static_cast<int>(parameterCount), LUA_MULTRET, 0);
+        budget.uninstall(lua);
+
+        status = translateStatus(lua, budget, status);
+        return std::make_pair(status, static_cast<size_t>(lua_gettop(lua) - base));
+    }
+
+    std::pair<int, int> resume(lua_State* thread, lua_State* from, Budget& budget, const EasyLua::ParameterCount& parameterCount)
+    {
+        budget.install(thread);
+
+        #if LUA_VERSION_NUM >= 504
+            int results = 0;
+            int status = lua_resume(thread, from, static_cast<int>(parameterCount), &results);
+        #else
+            int status = lua_resume(thread, from, static_cast<int>(parameterCount));
+            int results = status == LUA_OK || status == LUA_YIELD ? lua_gettop(thread) : 1;
+        #endif
+
+        budget.uninstall(thread);
+
+        status = translateStatus(thread, budget, status);
+        return std::make_pair(status, results);
+    }
+} // End NameSpace EasyLua
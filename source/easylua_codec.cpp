@@ -0,0 +1,267 @@
+/**
+ *  @file easylua_codec.cpp
+ *  @brief Source file implementing the compact binary encoding of Lua values.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <easylua_codec.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Reads the raw bytes of a value.
+     *  @param position The position to read at, advanced past the value.
+     *  @param end The end of the buffer.
+     *  @return The value.
+     *  @throw std::runtime_error Thrown when the buffer ends early.
+     */
+    template <typename type>
+    static INLINE type readRaw(const char*& position, const char* end)
+    {
+        if (static_cast<size_t>(end - position) < sizeof(type))
+            throw std::runtime_error("Truncated value encoding!");
+
+        type result;
+        std::memcpy(&result, position, sizeof(type));
+        position += sizeof(type);
+        return result;
+    }
+
+    bool ValueCodec::encodeValue(lua_State* lua, const int& index, std::string& out, const int& depth)
+    {
+        switch (lua_type(lua, index))
+        {
+            case LUA_TNIL:
+            {
+                out.push_back(static_cast<char>(TAG_NIL));
+                return true;
+            }
+
+            case LUA_TBOOLEAN:
+            {
+                out.push_back(static_cast<char>(lua_toboolean(lua, index) ? TAG_TRUE : TAG_FALSE));
+                return true;
+            }
+
+            case LUA_TNUMBER:
+            {
+                if (lua_isinteger(lua, index))
+                {
+                    out.push_back(static_cast<char>(TAG_INTEGER));
+                    writeRaw(out, static_cast<int64_t>(lua_tointeger(lua, index)));
+                }
+                else
+                {
+                    out.push_back(static_cast<char>(TAG_NUMBER));
+                    writeRaw(out, static_cast<double>(lua_tonumber(lua, index)));
+                }
+                return true;
+            }
+
+            case LUA_TSTRING:
+            {
+                size_t length = 0;
+                const char* value = lua_tolstring(lua, index, &length);
+
+                if (length > UINT32_MAX)
+                    break;
+
+                out.push_back(static_cast<char>(TAG_STRING));
+                writeRaw(out, static_cast<uint32_t>(length));
+                out.append(value, length);
+                return true;
+            }
+
+            case LUA_TTABLE:
+            {
+                if (depth >= MAXIMUM_DEPTH || !lua_checkstack(lua, 3))
+                    break;
+
+                const int table = lua_absindex(lua, index);
+                bool complete = true;
+
+                // Encode every entry on its own so they can be put in a canonical order
+                std::vector<std::pair<std::string, std::string>> entries;
+
+                lua_pushnil(lua);
+                while (lua_next(lua, table))
+                {
+                    std::pair<std::string, std::string> entry;
+                    complete &= ValueCodec::encodeValue(lua, -2, entry.first, depth + 1);
+                    complete &= ValueCodec::encodeValue(lua, -1, entry.second, depth + 1);
+
+                    entries.push_back(std::move(entry));
+                    lua_pop(lua, 1);
+                }
+
+                std::sort(entries.begin(), entries.end());
+
+                out.push_back(static_cast<char>(TAG_TABLE));
+                writeRaw(out, static_cast<uint32_t>(entries.size()));
+
+                for (auto it = entries.begin(); it != entries.end(); it++)
+                {
+                    out.append((*it).first);
+                    out.append((*it).second);
+                }
+
+                return complete;
+            }
+
+            default:
+                break;
+        }
+
+        out.push_back(static_cast<char>(TAG_OPAQUE));
+        return false;
+    }
+
+    const char* ValueCodec::decodeValue(lua_State* lua, const char* begin, const char* end, const int& depth)
+    {
+        if (begin == end)
+            throw std::runtime_error("Truncated value encoding!");
+        else if (!lua_checkstack(lua, 3))
+            throw std::runtime_error("Not enough stack space to decode value!");
+
+        const char* position = begin + 1;
+
+        switch (static_cast<unsigned char>(*begin))
+        {
+            case TAG_NIL:
+            case TAG_OPAQUE:
+            {
+                lua_pushnil(lua);
+                return position;
+            }
+
+            case TAG_FALSE:
+            case TAG_TRUE:
+            {
+                lua_pushboolean(lua, *begin == TAG_TRUE);
+                return position;
+            }
+
+            case TAG_INTEGER:
+            {
+                lua_pushinteger(lua, static_cast<lua_Integer>(readRaw<int64_t>(position, end)));
+                return position;
+            }
+
+            case TAG_NUMBER:
+            {
+                lua_pushnumber(lua, static_cast<lua_Number>(readRaw<double>(position, end)));
+                return position;
+            }
+
+            case TAG_STRING:
+            {
+                const uint32_t length = readRaw<uint32_t>(position, end);
+
+                if (static_cast<size_t>(end - position) < length)
+                    throw std::runtime_error("Truncated value encoding!");
+
+                lua_pushlstring(lua, position, length);
+                return position + length;
+            }
+
+            case TAG_TABLE:
+            {
+                if (depth >= MAXIMUM_DEPTH)
+                    throw std::runtime_error("Value encoding nested too deeply!");
+
+                const uint32_t count = readRaw<uint32_t>(position, end);
+
+                // Every entry takes at least two bytes, which bounds the preallocation for malformed input
+                lua_createtable(lua, 0, static_cast<int>(std::min<size_t>(count, static_cast<size_t>(end - position) / 2)));
+
+                for (uint32_t entry = 0; entry < count; ++entry)
+                {
+                    position = ValueCodec::decodeValue(lua, position, end, depth + 1);
+                    position = ValueCodec::decodeValue(lua, position, end, depth + 1);
+
+                    // Opaque keys decode to nil and cannot be stored
+                    if (lua_isnil(lua, -2))
+                    {
+                        lua_pop(lua, 2);
+                        continue;
+                    }
+
+                    // Lua raises an error for NaN keys, which would skip restoring the stack
+                    if (lua_type(lua, -2) == LUA_TNUMBER && !lua_isinteger(lua, -2) && std::isnan(lua_tonumber(lua, -2)))
+                        throw std::runtime_error("NaN table key in value encoding!");
+
+                    lua_rawset(lua, -3);
+                }
+
+                return position;
+            }
+
+            default:
+                throw std::runtime_error("Unknown value encoding tag!");
+        }
+    }
+
+    bool ValueCodec::encode(lua_State* lua, const int& index, std::string& out)
+    {
+        return ValueCodec::encodeValue(lua, index, out, 0);
+    }
+
+    bool ValueCodec::encode(lua_State* lua, const int& first, const int& count, std::string& out)
+    {
+        const int start = lua_absindex(lua, first);
+        bool complete = true;
+
+        for (int index = start; index < start + count; ++index)
+            complete &= ValueCodec::encodeValue(lua, index, out, 0);
+
+        return complete;
+    }
+
+    const char* ValueCodec::decode(lua_State* lua, const char* begin, const char* end)
+    {
+        const int top = lua_gettop(lua);
+
+        try
+        {
+            return ValueCodec::decodeValue(lua, begin, end, 0);
+        }
+        catch (...)
+        {
+            lua_settop(lua, top);
+            throw;
+        }
+    }
+
+    int ValueCodec::decode(lua_State* lua, const std::string& data)
+    {
+        const int top = lua_gettop(lua);
+        const char* position = data.data();
+        const char* end = data.data() + data.size();
+
+        try
+        {
+            while (position != end)
+                position = ValueCodec::decodeValue(lua, position, end, 0);
+        }
+        catch (...)
+        {
+            lua_settop(lua, top);
+            throw;
+        }
+
+        return lua_gettop(lua) - top;
+    }
+} // End NameSpace EasyLua
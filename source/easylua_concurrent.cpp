@@ -0,0 +1,456 @@
+/**
+ *  @file easylua_concurrent.cpp
+ *  @brief Source file implementing a Table variant for concurrent readers and writers.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <functional>
+#include <stdexcept>
+
+#include <easylua_concurrent.hpp>
+
+namespace EasyLua
+{
+    //! How many buckets a shard replaces before handing them to the epoch domain.
+    static const size_t CONCURRENT_RECLAIM_INTERVAL = 32;
+
+    //! How many buckets every shard starts with. Must be a power of two.
+    static const size_t CONCURRENT_INITIAL_BUCKETS = 8;
+
+    ConcurrentTable::ConcurrentTable(const size_t& shards) : mShards(new Shard[shards == 0 ? 1 : shards]), mShardCount(shards == 0 ? 1 : shards)
+    {
+        for (size_t index = 0; index < mShardCount; ++index)
+        {
+            mShards[index].buckets.store(new Buckets(CONCURRENT_INITIAL_BUCKETS), std::memory_order_release);
+            mShards[index].count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentTable::~ConcurrentTable(void)
+    {
+        for (size_t index = 0; index < mShardCount; ++index)
+        {
+            Shard& shard = mShards[index];
+            const Buckets* buckets = shard.buckets.load(std::memory_order_acquire);
+
+            for (auto it = buckets->slots.begin(); it != buckets->slots.end(); it++)
+                delete (*it).load(std::memory_order_relaxed);
+            delete buckets;
+
+            for (auto it = shard.retiredBuckets.begin(); it != shard.retiredBuckets.end(); it++)
+                delete *it;
+            for (auto it = shard.retiredArrays.begin(); it != shard.retiredArrays.end(); it++)
+                delete *it;
+        }
+    }
+
+    ConcurrentTable::Buckets::Buckets(const size_t& size) : slots(size)
+    {
+        for (auto it = slots.begin(); it != slots.end(); it++)
+            (*it).store(nullptr, std::memory_order_relaxed);
+    }
+
+    void ConcurrentTable::write(const std::string& key, const Value* value)
+    {
+        const size_t hash = std::hash<std::string>()(key);
+        Shard& shard = mShards[hash % mShardCount];
+
+        std::vector<const Bucket*> retiredBuckets;
+        std::vector<const Buckets*> retiredArrays;
+
+        {
+            std::lock_guard<std::mutex> lock(shard.lock);
+
+            // Only holders of this lock replace anything in this shard
+            Buckets* buckets = shard.buckets.load(std::memory_order_relaxed);
+            std::atomic<const Bucket*>& slot = buckets->slots[this->bucket(hash, *buckets)];
+            const Bucket* old = slot.load(std::memory_order_relaxed);
+
+            // Copy the bucket alone, leaving out any previous value of the key
+            std::unique_ptr<Bucket> updated(new Bucket());
+            bool replaced = false;
+
+            if (old)
+            {
+                updated->entries.reserve(old->entries.size() + 1);
+
+                for (auto it = old->entries.begin(); it != old->entries.end(); it++)
+                {
+                    if ((*it).first == key)
+                        replaced = true;
+                    else
+                        updated->entries.push_back(*it);
+                }
+            }
+
+            // Removing a key that does not exist changes nothing
+            if (!value && !replaced)
+                return;
+
+            if (value)
+                updated->entries.push_back(std::make_pair(key, *value));
+
+            const size_t count = shard.count.load(std::memory_order_relaxed) + (value ? 1 : 0) - (replaced ? 1 : 0);
+            slot.store(updated->entries.empty() ? nullptr : updated.release(), std::memory_order_release);
+            shard.count.store(count, std::memory_order_release);
+
+            if (old)
+                shard.retiredBuckets.push_back(old);
+
+            if (count > buckets->slots.size())
+                this->grow(shard);
+
+            // Hand replaced buckets over in batches so writers rarely meet at the epoch domain
+            if (shard.retiredBuckets.size() >= CONCURRENT_RECLAIM_INTERVAL || !shard.retiredArrays.empty())
+            {
+                retiredBuckets.swap(shard.retiredBuckets);
+                retiredArrays.swap(shard.retiredArrays);
+            }
+        }
+
+        if (retiredBuckets.empty() && retiredArrays.empty())
+            return;
+
+        mEpochs.retire([retiredBuckets, retiredArrays]()
+        {
+            for (auto it = retiredBuckets.begin(); it != retiredBuckets.end(); it++)
+                delete *it;
+            for (auto it = retiredArrays.begin(); it != retiredArrays.end(); it++)
+                delete *it;
+        });
+
+        mEpochs.reclaim();
+    }
+
+    void ConcurrentTable::grow(Shard& shard)
+    {
+        Buckets* old = shard.buckets.load(std::memory_order_relaxed);
+        const size_t size = old->slots.size() * 2;
+
+        // Rehash into unpublished buckets, which may still be modified freely
+        std::vector<std::unique_ptr<Bucket>> rehashed(size);
+        std::unique_ptr<Buckets> grown(new Buckets(size));
+
+        for (auto it = old->slots.begin(); it != old->slots.end(); it++)
+        {
+            const Bucket* bucket = (*it).load(std::memory_order_relaxed);
+            if (!bucket)
+                continue;
+
+            for (auto entry = bucket->entries.begin(); entry != bucket->entries.end(); entry++)
+            {
+                std::unique_ptr<Bucket>& target = rehashed[this->bucket(std::hash<std::string>()((*entry).first), *grown)];
+                if (!target)
+                    target.reset(new Bucket());
+
+                target->entries.push_back(*entry);
+            }
+        }
+
+        for (size_t index = 0; index < size; ++index)
+            grown->slots[index].store(rehashed[index].release(), std::memory_order_relaxed);
+
+        // Readers still holding the old array see the old buckets, which are left intact
+        shard.buckets.store(grown.release(), std::memory_order_release);
+
+        for (auto it = old->slots.begin(); it != old->slots.end(); it++)
+        {
+            const Bucket* bucket = (*it).load(std::memory_order_relaxed);
+            if (bucket)
+                shard.retiredBuckets.push_back(bucket);
+        }
+
+        shard.retiredArrays.push_back(old);
+    }
+
+    void ConcurrentTable::set(const std::string& key, const int& value)
+    {
+        Value stored;
+        stored.type = EASYLUA_INTEGER;
+        stored.integer = value;
+        this->write(key, &stored);
+    }
+
+    void ConcurrentTable::set(const std::string& key, const float& value)
+    {
+        Value stored;
+        stored.type = EASYLUA_FLOAT;
+        stored.number = value;
+        this->write(key, &stored);
+    }
+
+    void ConcurrentTable::set(const std::string& key, const std::string& value)
+    {
+        Value stored;
+        stored.type = EASYLUA_STRING;
+        stored.string = value;
+        this->write(key, &stored);
+    }
+
+    void ConcurrentTable::set(const std::string& key, Table& value)
+    {
+        Value stored;
+        stored.type = EASYLUA_TABLE;
+        stored.table = ConcurrentTable::freezeTable(value);
+        this->write(key, &stored);
+    }
+
+    void ConcurrentTable::remove(const std::string& key)
+    {
+        this->write(key, nullptr);
+    }
+
+    const ConcurrentTable::Value* ConcurrentTable::lookup(const std::string& key) const
+    {
+        const size_t hash = std::hash<std::string>()(key);
+        const Buckets* buckets = mShards[hash % mShardCount].buckets.load(std::memory_order_acquire);
+        const Bucket* bucket = buckets->slots[this->bucket(hash, *buckets)].load(std::memory_order_acquire);
+
+        if (!bucket)
+            return nullptr;
+
+        for (auto it = bucket->entries.begin(); it != bucket->entries.end(); it++)
+            if ((*it).first == key)
+                return &(*it).second;
+
+        return nullptr;
+    }
+
+    const ConcurrentTable::Value& ConcurrentTable::find(const std::string& key, const unsigned char& type) const
+    {
+        const Value* found = this->lookup(key);
+
+        if (!found)
+            throw std::out_of_range("No such key!");
+        else if (found->type != type)
+            throw std::runtime_error("Mismatched types!");
+
+        return *found;
+    }
+
+    std::vector<const ConcurrentTable::Bucket*> ConcurrentTable::capture(size_t& count)
+    {
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.reserve(mShardCount);
+
+        // Writers only ever hold one shard lock, so taking all of them in order cannot deadlock
+        for (size_t index = 0; index < mShardCount; ++index)
+            locks.push_back(std::unique_lock<std::mutex>(mShards[index].lock));
+
+        std::vector<const Bucket*> result;
+        count = 0;
+
+        for (size_t index = 0; index < mShardCount; ++index)
+        {
+            const Buckets* buckets = mShards[index].buckets.load(std::memory_order_relaxed);
+            count += mShards[index].count.load(std::memory_order_relaxed);
+
+            for (auto it = buckets->slots.begin(); it != buckets->slots.end(); it++)
+            {
+                const Bucket* bucket = (*it).load(std::memory_order_relaxed);
+                if (bucket)
+                    result.push_back(bucket);
+            }
+        }
+
+        return result;
+    }
+
+    void ConcurrentTable::get(Reader& reader, const std::string& key, int& out)
+    {
+        EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+        out = this->find(key, EASYLUA_INTEGER).integer;
+    }
+
+    void ConcurrentTable::get(Reader& reader, const std::string& key, float& out)
+    {
+        EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+        out = this->find(key, EASYLUA_FLOAT).number;
+    }
+
+    void ConcurrentTable::get(Reader& reader, const std::string& key, std::string& out)
+    {
+        EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+        out = this->find(key, EASYLUA_STRING).string;
+    }
+
+    void ConcurrentTable::get(Reader& reader, const std::string& key, Table& out)
+    {
+        std::shared_ptr<const Node> node;
+
+        {
+            EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+            node = this->find(key, EASYLUA_TABLE).table;
+        }
+
+        out.clear(true);
+        ConcurrentTable::thawTable(*node, out);
+    }
+
+    bool ConcurrentTable::contains(Reader& reader, const std::string& key)
+    {
+        EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+        return this->lookup(key) != nullptr;
+    }
+
+    size_t ConcurrentTable::size(Reader& reader)
+    {
+        size_t result = 0;
+
+        for (size_t index = 0; index < mShardCount; ++index)
+            result += mShards[index].count.load(std::memory_order_acquire);
+
+        return result;
+    }
+
+    void ConcurrentTable::push(Reader& reader, lua_State* lua)
+    {
+        EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+
+        size_t count;
+        const std::vector<const Bucket*> buckets = this->capture(count);
+
+        lua_createtable(lua, 0, static_cast<int>(count));
+
+        for (auto bucket = buckets.begin(); bucket != buckets.end(); bucket++)
+        {
+            for (auto it = (*bucket)->entries.begin(); it != (*bucket)->entries.end(); it++)
+            {
+                lua_pushlstring(lua, (*it).first.data(), (*it).first.size());
+                ConcurrentTable::pushValue(lua, (*it).second);
+                lua_rawset(lua, -3);
+            }
+        }
+    }
+
+    void ConcurrentTable::copy(Reader& reader, Table& out)
+    {
+        Node node;
+
+        {
+            EpochDomain::Guard guard(mEpochs, *reader.mSlot);
+
+            size_t count;
+            const std::vector<const Bucket*> buckets = this->capture(count);
+
+            node.entries.reserve(count);
+            for (auto bucket = buckets.begin(); bucket != buckets.end(); bucket++)
+                node.entries.insert(node.entries.end(), (*bucket)->entries.begin(), (*bucket)->entries.end());
+        }
+
+        out.clear(true);
+        ConcurrentTable::thawTable(node, out);
+    }
+
+    std::shared_ptr<const ConcurrentTable::Node> ConcurrentTable::freezeTable(Table& table)
+    {
+        std::shared_ptr<Node> result = std::make_shared<Node>();
+        result->entries.reserve(table.mTypes.size());
+
+        for (auto it = table.mTypes.begin(); it != table.mTypes.end(); it++)
+        {
+            const std::string& name = (*it).first;
+            void* memory = table.mContents[name];
+
+            Value value;
+            value.type = (*it).second.second;
+
+            switch (value.type)
+            {
+                case EASYLUA_INTEGER:
+                    value.integer = *reinterpret_cast<int*>(memory);
+                    break;
+
+                case EASYLUA_FLOAT:
+                    value.number = *reinterpret_cast<float*>(memory);
+                    break;
+
+                case EASYLUA_STRING:
+                    value.string = *reinterpret_cast<std::string*>(memory);
+                    break;
+
+                case EASYLUA_TABLE:
+                    value.table = ConcurrentTable::freezeTable(*reinterpret_cast<Table*>(memory));
+                    break;
+            }
+
+            result->entries.push_back(std::make_pair(name, std::move(value)));
+        }
+
+        return result;
+    }
+
+    void ConcurrentTable::thawTable(const Node& node, Table& out)
+    {
+        for (auto it = node.entries.begin(); it != node.entries.end(); it++)
+        {
+            const std::string& name = (*it).first;
+            const Value& value = (*it).second;
+
+            switch (value.type)
+            {
+                case EASYLUA_INTEGER:
+                    out.set(name, value.integer);
+                    break;
+
+                case EASYLUA_FLOAT:
+                    out.set(name, value.number);
+                    break;
+
+                case EASYLUA_STRING:
+                    out.set(name, value.string);
+                    break;
+
+                case EASYLUA_TABLE:
+                {
+                    Table child;
+                    ConcurrentTable::thawTable(*value.table, child);
+                    out.set(name, child);
+                    break;
+                }
+            }
+        }
+    }
+
+    void ConcurrentTable::pushValue(lua_State* lua, const Value& value)
+    {
+        switch (value.type)
+        {
+            case EASYLUA_INTEGER:
+                lua_pushinteger(lua, value.integer);
+                break;
+
+            case EASYLUA_FLOAT:
+                lua_pushnumber(lua, value.number);
+                break;
+
+            case EASYLUA_STRING:
+                lua_pushlstring(lua, value.string.data(), value.string.size());
+                break;
+
+            case EASYLUA_TABLE:
+            {
+                lua_createtable(lua, 0, static_cast<int>(value.table->entries.size()));
+
+                for (auto it = value.table->entries.begin(); it != value.table->entries.end(); it++)
+                {
+                    lua_pushlstring(lua, (*it).first.data(), (*it).first.size());
+                    ConcurrentTable::pushValue(lua, (*it).second);
+                    lua_rawset(lua, -3);
+                }
+
+                break;
+            }
+
+            default:
+                lua_pushnil(lua);
+                break;
+        }
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,98 @@
+/**
+ *  @file easylua_epoch.cpp
+ *  @brief Source file implementing the epoch based reclamation.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_epoch.hpp>
+
+namespace EasyLua
+{
+    EpochDomain::EpochDomain(void) : mEpoch(1)
+    {
+    }
+
+    EpochDomain::~EpochDomain(void)
+    {
+        for (auto it = mRetired.begin(); it != mRetired.end(); it++)
+            (*it).deleter();
+    }
+
+    EpochDomain::Reader* EpochDomain::registerReader(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (auto it = mReaders.begin(); it != mReaders.end(); it++)
+        {
+            if (!(*it)->mRegistered)
+            {
+                (*it)->mRegistered = true;
+                return it->get();
+            }
+        }
+
+        mReaders.emplace_back(new Reader());
+        mReaders.back()->mRegistered = true;
+        return mReaders.back().get();
+    }
+
+    void EpochDomain::unregisterReader(Reader* reader)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        reader->mEpoch.store(0, std::memory_order_release);
+        reader->mDepth = 0;
+        reader->mRegistered = false;
+    }
+
+    void EpochDomain::retire(std::function<void()> deleter)
+    {
+        // The data is already unreachable, so anyone entering after this increment cannot observe it
+        const uint64_t epoch = mEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mRetired.push_back({ epoch, std::move(deleter) });
+    }
+
+    size_t EpochDomain::reclaim(void)
+    {
+        std::vector<std::function<void()>> freed;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            // Readers that entered at or before a retirement may still hold what was retired
+            uint64_t oldest = UINT64_MAX;
+            for (auto it = mReaders.begin(); it != mReaders.end(); it++)
+            {
+                const uint64_t epoch = (*it)->mEpoch.load(std::memory_order_seq_cst);
+                if (epoch != 0 && epoch < oldest)
+                    oldest = epoch;
+            }
+
+            auto kept = mRetired.begin();
+            for (auto it = mRetired.begin(); it != mRetired.end(); it++)
+            {
+                if ((*it).epoch < oldest)
+                    freed.push_back(std::move((*it).deleter));
+                else
+                    *kept++ = std::move(*it);
+            }
+
+            mRetired.erase(kept, mRetired.end());
+        }
+
+        // Deleters run outside of the lock as they may be arbitrarily expensive
+        for (auto it = freed.begin(); it != freed.end(); it++)
+            (*it)();
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mRetired.size();
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,117 @@
+/**
+ *  @file easylua_gc.cpp
+ *  @brief Source file implementing explicit garbage collection scheduling.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <stdexcept>
+
+#include <easylua_gc.hpp>
+
+namespace EasyLua
+{
+    GCController::GCController(lua_State* lua) : mLua(lua), mSuspensions(0), mWasRunning(true)
+    {
+        this->resetStatistics();
+    }
+
+    void GCController::incremental(const int& pause, const int& stepMultiplier, const int& stepSize)
+    {
+        #if LUA_VERSION_NUM >= 504
+            lua_gc(mLua, LUA_GCINC, pause, stepMultiplier, stepSize);
+        #else
+            if (pause != 0)
+                lua_gc(mLua, LUA_GCSETPAUSE, pause);
+            if (stepMultiplier != 0)
+                lua_gc(mLua, LUA_GCSETSTEPMUL, stepMultiplier);
+        #endif
+    }
+
+    void GCController::generational(const int& minorMultiplier, const int& majorMultiplier)
+    {
+        #if LUA_VERSION_NUM >= 504
+            lua_gc(mLua, LUA_GCGEN, minorMultiplier, majorMultiplier);
+        #else
+            throw std::runtime_error("Generational collection requires Lua 5.4!");
+        #endif
+    }
+
+    void GCController::suspend(void)
+    {
+        if (mSuspensions++ == 0)
+        {
+            mWasRunning = lua_gc(mLua, LUA_GCISRUNNING, 0) != 0;
+            lua_gc(mLua, LUA_GCSTOP, 0);
+        }
+    }
+
+    void GCController::resume(void)
+    {
+        if (mSuspensions == 0)
+            throw std::runtime_error("Attempted to resume collection that was not suspended!");
+
+        if (--mSuspensions == 0 && mWasRunning)
+            lua_gc(mLua, LUA_GCRESTART, 0);
+    }
+
+    bool GCController::idle(const std::chrono::nanoseconds& budget, const int& stepSize)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const std::chrono::steady_clock::time_point deadline = start + budget;
+
+        std::chrono::steady_clock::time_point now = start;
+        bool completed = false;
+
+        do
+        {
+            completed = lua_gc(mLua, LUA_GCSTEP, stepSize) != 0;
+
+            const std::chrono::steady_clock::time_point stepStart = now;
+            now = std::chrono::steady_clock::now();
+            this->record(now - stepStart);
+        }
+        while (!completed && now < deadline);
+
+        if (completed)
+            ++mStatistics.cycles;
+
+        return completed;
+    }
+
+    void GCController::collect(void)
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        lua_gc(mLua, LUA_GCCOLLECT, 0);
+        this->record(std::chrono::steady_clock::now() - start);
+
+        ++mStatistics.cycles;
+    }
+
+    size_t GCController::memory(void) const
+    {
+        return static_cast<size_t>(lua_gc(mLua, LUA_GCCOUNT, 0)) * 1024 + static_cast<size_t>(lua_gc(mLua, LUA_GCCOUNTB, 0));
+    }
+
+    void GCController::resetStatistics(void)
+    {
+        mStatistics.steps = 0;
+        mStatistics.cycles = 0;
+        mStatistics.time = std::chrono::nanoseconds::zero();
+        mStatistics.longest = std::chrono::nanoseconds::zero();
+    }
+
+    void GCController::record(const std::chrono::nanoseconds& time)
+    {
+        ++mStatistics.steps;
+        mStatistics.time += time;
+
+        if (time > mStatistics.longest)
+            mStatistics.longest = time;
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,306 @@
+/**
+ *  @file easylua_kernels.hpp
+ *  @brief Private include file declaring the typed array kernels.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#ifndef _INCLUDE_EASYLUA_KERNELS_HPP_
+#define _INCLUDE_EASYLUA_KERNELS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace EasyLua
+{
+    namespace Kernels
+    {
+        /**
+         *  @brief The kernels for one element type, chosen once for the running CPU.
+         *  @param scalar The element type.
+         *  @param total The type sums and dot products are accumulated into.
+         */
+        template <typename scalar, typename total>
+        struct KernelSet
+        {
+            //! Returns the sum of all elements.
+            total (*sum)(const scalar* data, size_t length);
+            //! Returns the smallest element. The length must not be zero.
+            scalar (*minimum)(const scalar* data, size_t length);
+            //! Returns the largest element. The length must not be zero.
+            scalar (*maximum)(const scalar* data, size_t length);
+            //! Returns the dot product of two arrays of the same length.
+            total (*dot)(const scalar* first, const scalar* second, size_t length);
+            //! Computes y = alpha * x + y.
+            void (*axpy)(scalar alpha, const scalar* x, scalar* y, size_t length);
+            //! Multiplies every element by the factor.
+            void (*scale)(scalar factor, scalar* data, size_t length);
+            //! Limits every element to the range [low, high].
+            void (*clamp)(scalar low, scalar high, scalar* data, size_t length);
+            //! Replaces every element with the inclusive sum of the elements up to it.
+            void (*prefixSum)(scalar* data, size_t length);
+        };
+
+        typedef KernelSet<float, double> Float32Kernels;
+        typedef KernelSet<double, double> Float64Kernels;
+        typedef KernelSet<int32_t, int64_t> Int32Kernels;
+
+        /**
+         *  @brief Installs the AVX2 kernels. Defined in easylua_kernels_avx2.cpp, which is the only translation
+         *  unit compiled for AVX2.
+         *  @return False, leaving the sets untouched, when the kernels were not built or the CPU lacks AVX2.
+         */
+        bool installAvx2(Float32Kernels& float32, Float64Kernels& float64, Int32Kernels& int32);
+
+        // The loops are compiled once per instruction set by each translation unit including this file, so
+        // they must never be shared between translation units through the linker.
+#ifdef EASYLUA_KERNELS_AVX2
+    #if defined(__clang__)
+        #pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+    #else
+        #pragma GCC push_options
+        #pragma GCC target("avx2")
+    #endif
+#endif
+        namespace
+        {
+            /**
+             *  @brief Lanes of a single element, used for the scalar fallback and for the tails of the vector loops.
+             *  Integer arithmetic wraps rather than overflowing.
+             */
+            template <typename scalarType, typename totalType>
+            struct ScalarLanes
+            {
+                typedef scalarType scalar;
+                typedef scalarType vector;
+                typedef totalType accumulator;
+                typedef totalType total;
+
+                static constexpr size_t width = 1;
+
+                static inline vector load(const scalar* data) { return *data; }
+                static inline void store(scalar* data, const vector& value) { *data = value; }
+                static inline vector broadcast(const scalar& value) { return value; }
+                static inline accumulator zero(void) { return 0; }
+
+                static inline vector add(const vector& first, const vector& second)
+                {
+                    if constexpr (std::is_integral<scalar>::value)
+                    {
+                        typedef typename std::make_unsigned<scalar>::type unsignedType;
+                        return static_cast<scalar>(static_cast<unsignedType>(first) + static_cast<unsignedType>(second));
+                    }
+                    else
+                        return first + second;
+                }
+
+                static inline vector multiply(const vector& first, const vector& second)
+                {
+                    if constexpr (std::is_integral<scalar>::value)
+                    {
+                        typedef typename std::make_unsigned<scalar>::type unsignedType;
+                        return static_cast<scalar>(static_cast<unsignedType>(first) * static_cast<unsignedType>(second));
+                    }
+                    else
+                        return first * second;
+                }
+
+                static inline vector minimum(const vector& first, const vector& second) { return second < first ? second : first; }
+                static inline vector maximum(const vector& first, const vector& second) { return first < second ? second : first; }
+
+                static inline accumulator accumulate(const accumulator& sum, const vector& value) { return sum + static_cast<total>(value); }
+
+                static inline accumulator multiplyAccumulate(const accumulator& sum, const vector& first, const vector& second)
+                {
+                    return sum + static_cast<total>(first) * static_cast<total>(second);
+                }
+
+                static inline total reduce(const accumulator& sum) { return sum; }
+
+                static inline vector scan(const vector& value) { return value; }
+                static inline vector broadcastLast(const vector& value) { return value; }
+            };
+
+            /**
+             *  @brief The kernel loops, written once against a lanes type describing one instruction set. A lanes
+             *  type provides the vector and accumulator types, the lane count and the element-wise operations used
+             *  below, including an in-register inclusive scan for prefix sums.
+             */
+            template <typename lanes>
+            struct Loops
+            {
+                typedef typename lanes::scalar scalar;
+                typedef typename lanes::vector vector;
+                typedef typename lanes::accumulator accumulator;
+                typedef typename lanes::total total;
+                typedef ScalarLanes<scalar, total> tail;
+
+                static constexpr size_t width = lanes::width;
+
+                static total sum(const scalar* data, size_t length)
+                {
+                    accumulator first = lanes::zero();
+                    accumulator second = lanes::zero();
+                    size_t position = 0;
+
+                    // Two independent accumulators hide the latency of the additions
+                    for (; position + 2 * width <= length; position += 2 * width)
+                    {
+                        first = lanes::accumulate(first, lanes::load(data + position));
+                        second = lanes::accumulate(second, lanes::load(data + position + width));
+                    }
+
+                    for (; position + width <= length; position += width)
+                        first = lanes::accumulate(first, lanes::load(data + position));
+
+                    total result = lanes::reduce(first) + lanes::reduce(second);
+                    for (; position < length; ++position)
+                        result = tail::accumulate(result, data[position]);
+
+                    return result;
+                }
+
+                template <bool greatest>
+                static scalar extreme(const scalar* data, size_t length)
+                {
+                    scalar result = data[0];
+                    size_t position = 0;
+
+                    if (length >= width)
+                    {
+                        vector best = lanes::load(data);
+
+                        for (position = width; position + width <= length; position += width)
+                        {
+                            if constexpr (greatest)
+                                best = lanes::maximum(best, lanes::load(data + position));
+                            else
+                                best = lanes::minimum(best, lanes::load(data + position));
+                        }
+
+                        scalar values[width];
+                        lanes::store(values, best);
+
+                        for (size_t lane = 0; lane < width; ++lane)
+                            result = greatest ? tail::maximum(result, values[lane]) : tail::minimum(result, values[lane]);
+                    }
+
+                    for (; position < length; ++position)
+                        result = greatest ? tail::maximum(result, data[position]) : tail::minimum(result, data[position]);
+
+                    return result;
+                }
+
+                static scalar minimum(const scalar* data, size_t length) { return extreme<false>(data, length); }
+                static scalar maximum(const scalar* data, size_t length) { return extreme<true>(data, length); }
+
+                static total dot(const scalar* first, const scalar* second, size_t length)
+                {
+                    accumulator even = lanes::zero();
+                    accumulator odd = lanes::zero();
+                    size_t position = 0;
+
+                    for (; position + 2 * width <= length; position += 2 * width)
+                    {
+                        even = lanes::multiplyAccumulate(even, lanes::load(first + position), lanes::load(second + position));
+                        odd = lanes::multiplyAccumulate(odd, lanes::load(first + position + width), lanes::load(second + position + width));
+                    }
+
+                    for (; position + width <= length; position += width)
+                        even = lanes::multiplyAccumulate(even, lanes::load(first + position), lanes::load(second + position));
+
+                    total result = lanes::reduce(even) + lanes::reduce(odd);
+                    for (; position < length; ++position)
+                        result = tail::multiplyAccumulate(result, first[position], second[position]);
+
+                    return result;
+                }
+
+                static void axpy(scalar alpha, const scalar* x, scalar* y, size_t length)
+                {
+                    const vector factor = lanes::broadcast(alpha);
+                    size_t position = 0;
+
+                    for (; position + width <= length; position += width)
+                        lanes::store(y + position, lanes::add(lanes::multiply(factor, lanes::load(x + position)), lanes::load(y + position)));
+
+                    for (; position < length; ++position)
+                        y[position] = tail::add(tail::multiply(alpha, x[position]), y[position]);
+                }
+
+                static void scale(scalar factor, scalar* data, size_t length)
+                {
+                    const vector factors = lanes::broadcast(factor);
+                    size_t position = 0;
+
+                    for (; position + width <= length; position += width)
+                        lanes::store(data + position, lanes::multiply(factors, lanes::load(data + position)));
+
+                    for (; position < length; ++position)
+                        data[position] = tail::multiply(factor, data[position]);
+                }
+
+                static void clamp(scalar low, scalar high, scalar* data, size_t length)
+                {
+                    const vector lows = lanes::broadcast(low);
+                    const vector highs = lanes::broadcast(high);
+                    size_t position = 0;
+
+                    for (; position + width <= length; position += width)
+                        lanes::store(data + position, lanes::minimum(lanes::maximum(lanes::load(data + position), lows), highs));
+
+                    for (; position < length; ++position)
+                        data[position] = tail::minimum(tail::maximum(data[position], low), high);
+                }
+
+                static void prefixSum(scalar* data, size_t length)
+                {
+                    // The running total of every previous block, broadcast to all lanes
+                    vector carry = lanes::broadcast(0);
+                    size_t position = 0;
+
+                    for (; position + width <= length; position += width)
+                    {
+                        const vector block = lanes::add(lanes::scan(lanes::load(data + position)), carry);
+                        lanes::store(data + position, block);
+                        carry = lanes::broadcastLast(block);
+                    }
+
+                    scalar running = position == 0 ? 0 : data[position - 1];
+                    for (; position < length; ++position)
+                    {
+                        running = tail::add(running, data[position]);
+                        data[position] = running;
+                    }
+                }
+
+                static void install(KernelSet<scalar, total>& set)
+                {
+                    set.sum = sum;
+                    set.minimum = minimum;
+                    set.maximum = maximum;
+                    set.dot = dot;
+                    set.axpy = axpy;
+                    set.scale = scale;
+                    set.clamp = clamp;
+                    set.prefixSum = prefixSum;
+                }
+            };
+        }
+#ifdef EASYLUA_KERNELS_AVX2
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #else
+        #pragma GCC pop_options
+    #endif
+#endif
+    }
+} // End NameSpace EasyLua
+
+#endif // _INCLUDE_EASYLUA_KERNELS_HPP_
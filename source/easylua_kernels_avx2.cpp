@@ -0,0 +1,216 @@
+/**
+ *  @file easylua_kernels_avx2.cpp
+ *  @brief Source file implementing the AVX2 typed array kernels.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    // Only the shared loops and the lanes below are compiled for AVX2. Nothing compiled for AVX2 may run before
+    // the CPU check in installAvx2.
+    #define EASYLUA_KERNELS_AVX2
+
+    #include <immintrin.h>
+#endif
+
+#include "easylua_kernels.hpp"
+
+namespace EasyLua
+{
+    namespace Kernels
+    {
+#ifdef EASYLUA_KERNELS_AVX2
+    #if defined(__clang__)
+        #pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+    #else
+        #pragma GCC push_options
+        #pragma GCC target("avx2")
+    #endif
+        namespace
+        {
+            //! Eight float lanes.
+            struct Avx2Float32
+            {
+                typedef float scalar;
+                typedef __m256 vector;
+                typedef __m256 accumulator;
+                typedef double total;
+
+                static constexpr size_t width = 8;
+
+                static inline vector load(const scalar* data) { return _mm256_loadu_ps(data); }
+                static inline void store(scalar* data, const vector& value) { _mm256_storeu_ps(data, value); }
+                static inline vector broadcast(const scalar& value) { return _mm256_set1_ps(value); }
+                static inline accumulator zero(void) { return _mm256_setzero_ps(); }
+
+                static inline vector add(const vector& first, const vector& second) { return _mm256_add_ps(first, second); }
+                static inline vector multiply(const vector& first, const vector& second) { return _mm256_mul_ps(first, second); }
+                static inline vector minimum(const vector& first, const vector& second) { return _mm256_min_ps(first, second); }
+                static inline vector maximum(const vector& first, const vector& second) { return _mm256_max_ps(first, second); }
+
+                static inline accumulator accumulate(const accumulator& sum, const vector& value) { return _mm256_add_ps(sum, value); }
+                static inline accumulator multiplyAccumulate(const accumulator& sum, const vector& first, const vector& second) { return _mm256_add_ps(sum, _mm256_mul_ps(first, second)); }
+
+                static inline total reduce(const accumulator& sum)
+                {
+                    float values[width];
+                    _mm256_storeu_ps(values, sum);
+
+                    total result = 0;
+                    for (size_t lane = 0; lane < width; ++lane)
+                        result += values[lane];
+                    return result;
+                }
+
+                static inline vector scan(vector value)
+                {
+                    // Scan each 128 bit half, then carry the last element of the low half into the high half
+                    value = _mm256_add_ps(value, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(value), 4)));
+                    value = _mm256_add_ps(value, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(value), 8)));
+
+                    const __m256 low = _mm256_permute2f128_ps(value, value, 0x08);
+                    return _mm256_add_ps(value, _mm256_shuffle_ps(low, low, 0xFF));
+                }
+
+                static inline vector broadcastLast(const vector& value)
+                {
+                    const __m256 high = _mm256_permute2f128_ps(value, value, 0x11);
+                    return _mm256_shuffle_ps(high, high, 0xFF);
+                }
+            };
+
+            //! Four double lanes.
+            struct Avx2Float64
+            {
+                typedef double scalar;
+                typedef __m256d vector;
+                typedef __m256d accumulator;
+                typedef double total;
+
+                static constexpr size_t width = 4;
+
+                static inline vector load(const scalar* data) { return _mm256_loadu_pd(data); }
+                static inline void store(scalar* data, const vector& value) { _mm256_storeu_pd(data, value); }
+                static inline vector broadcast(const scalar& value) { return _mm256_set1_pd(value); }
+                static inline accumulator zero(void) { return _mm256_setzero_pd(); }
+
+                static inline vector add(const vector& first, const vector& second) { return _mm256_add_pd(first, second); }
+                static inline vector multiply(const vector& first, const vector& second) { return _mm256_mul_pd(first, second); }
+                static inline vector minimum(const vector& first, const vector& second) { return _mm256_min_pd(first, second); }
+                static inline vector maximum(const vector& first, const vector& second) { return _mm256_max_pd(first, second); }
+
+                static inline accumulator accumulate(const accumulator& sum, const vector& value) { return _mm256_add_pd(sum, value); }
+                static inline accumulator multiplyAccumulate(const accumulator& sum, const vector& first, const vector& second) { return _mm256_add_pd(sum, _mm256_mul_pd(first, second)); }
+
+                static inline total reduce(const accumulator& sum)
+                {
+                    double values[width];
+                    _mm256_storeu_pd(values, sum);
+                    return (values[0] + values[1]) + (values[2] + values[3]);
+                }
+
+                static inline vector scan(vector value)
+                {
+                    value = _mm256_add_pd(value, _mm256_castsi256_pd(_mm256_slli_si256(_mm256_castpd_si256(value), 8)));
+
+                    const __m256d low = _mm256_permute2f128_pd(value, value, 0x08);
+                    return _mm256_add_pd(value, _mm256_shuffle_pd(low, low, 0xF));
+                }
+
+                static inline vector broadcastLast(const vector& value)
+                {
+                    const __m256d high = _mm256_permute2f128_pd(value, value, 0x11);
+                    return _mm256_shuffle_pd(high, high, 0xF);
+                }
+            };
+
+            //! Eight 32 bit integer lanes. Sums and dot products are widened to 64 bits.
+            struct Avx2Int32
+            {
+                typedef int32_t scalar;
+                typedef __m256i vector;
+                typedef __m256i accumulator;
+                typedef int64_t total;
+
+                static constexpr size_t width = 8;
+
+                static inline vector load(const scalar* data) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)); }
+                static inline void store(scalar* data, const vector& value) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), value); }
+                static inline vector broadcast(const scalar& value) { return _mm256_set1_epi32(value); }
+                static inline accumulator zero(void) { return _mm256_setzero_si256(); }
+
+                static inline vector add(const vector& first, const vector& second) { return _mm256_add_epi32(first, second); }
+                static inline vector multiply(const vector& first, const vector& second) { return _mm256_mullo_epi32(first, second); }
+                static inline vector minimum(const vector& first, const vector& second) { return _mm256_min_epi32(first, second); }
+                static inline vector maximum(const vector& first, const vector& second) { return _mm256_max_epi32(first, second); }
+
+                static inline accumulator accumulate(const accumulator& sum, const vector& value)
+                {
+                    const __m256i low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(value));
+                    const __m256i high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(value, 1));
+                    return _mm256_add_epi64(sum, _mm256_add_epi64(low, high));
+                }
+
+                static inline accumulator multiplyAccumulate(const accumulator& sum, const vector& first, const vector& second)
+                {
+                    // _mm256_mul_epi32 multiplies the even lanes into 64 bit products; shifting exposes the odd lanes
+                    const __m256i even = _mm256_mul_epi32(first, second);
+                    const __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(first, 32), _mm256_srli_epi64(second, 32));
+                    return _mm256_add_epi64(sum, _mm256_add_epi64(even, odd));
+                }
+
+                static inline total reduce(const accumulator& sum)
+                {
+                    int64_t values[4];
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), sum);
+                    return (values[0] + values[1]) + (values[2] + values[3]);
+                }
+
+                static inline vector scan(vector value)
+                {
+                    value = _mm256_add_epi32(value, _mm256_slli_si256(value, 4));
+                    value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+
+                    const __m256i low = _mm256_permute2x128_si256(value, value, 0x08);
+                    return _mm256_add_epi32(value, _mm256_shuffle_epi32(low, 0xFF));
+                }
+
+                static inline vector broadcastLast(const vector& value)
+                {
+                    const __m256i high = _mm256_permute2x128_si256(value, value, 0x11);
+                    return _mm256_shuffle_epi32(high, 0xFF);
+                }
+            };
+        }
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #else
+        #pragma GCC pop_options
+    #endif
+#endif
+
+        bool installAvx2(Float32Kernels& float32, Float64Kernels& float64, Int32Kernels& int32)
+        {
+#ifdef EASYLUA_KERNELS_AVX2
+            if (!__builtin_cpu_supports("avx2"))
+                return false;
+
+            Loops<Avx2Float32>::install(float32);
+            Loops<Avx2Float64>::install(float64);
+            Loops<Avx2Int32>::install(int32);
+            return true;
+#else
+            return false;
+#endif
+        }
+    }
+} // End NameSpace EasyLua
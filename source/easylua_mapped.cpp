@@ -0,0 +1,412 @@
+/**
+ *  @file easylua_mapped.cpp
+ *  @brief Source file implementing the binary Table format and its memory mapped views.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#if defined(_WIN32)
+    #include <iterator>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include <easylua_mapped.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Appends a length prefixed, NUL terminated string.
+     *  @param out The buffer to append to.
+     *  @param value The string to append.
+     *  @return The offset of the length prefix.
+     */
+    static uint64_t writeString(std::string& out, const std::string& value)
+    {
+        const uint64_t offset = out.size();
+        const uint32_t length = static_cast<uint32_t>(value.size());
+
+        out.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.append(value);
+        out.push_back('\0');
+        return offset;
+    }
+
+    uint64_t Table::serializeNode(std::string& out)
+    {
+        std::vector<const std::string*> keys;
+        keys.reserve(mTypes.size());
+
+        for (auto it = mTypes.begin(); it != mTypes.end(); it++)
+            keys.push_back(&(*it).first);
+
+        std::sort(keys.begin(), keys.end(), [](const std::string* lhs, const std::string* rhs) { return *lhs < *rhs; });
+
+        // Strings and subtables first, so that the entries can refer to them
+        std::vector<MappedFormat::Entry> entries(keys.size());
+
+        for (size_t index = 0; index < keys.size(); ++index)
+        {
+            const std::string& key = *keys[index];
+            const unsigned char type = mTypes[key].second;
+            void* memory = mContents[key];
+
+            MappedFormat::Entry& entry = entries[index];
+            std::memset(&entry, 0, sizeof(entry));
+
+            entry.key = writeString(out, key);
+            entry.keyLength = static_cast<uint32_t>(key.size());
+            entry.type = type;
+
+            switch (type)
+            {
+                case EASYLUA_INTEGER:
+                {
+                    const int64_t value = *reinterpret_cast<int*>(memory);
+                    std::memcpy(&entry.value, &value, sizeof(value));
+                    break;
+                }
+
+                case EASYLUA_FLOAT:
+                {
+                    std::memcpy(&entry.value, memory, sizeof(float));
+                    break;
+                }
+
+                case EASYLUA_STRING:
+                {
+                    entry.value = writeString(out, *reinterpret_cast<std::string*>(memory));
+                    break;
+                }
+
+                case EASYLUA_TABLE:
+                {
+                    entry.value = reinterpret_cast<Table*>(memory)->serializeNode(out);
+                    break;
+                }
+            }
+        }
+
+        while (out.size() % 8 != 0)
+            out.push_back('\0');
+
+        const uint64_t offset = out.size();
+        const uint64_t count = entries.size();
+
+        out.append(reinterpret_cast<const char*>(&count), sizeof(count));
+        out.append(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(MappedFormat::Entry));
+        return offset;
+    }
+
+    std::string Table::serialize(void)
+    {
+        std::string result(sizeof(MappedFormat::Header), '\0');
+
+        MappedFormat::Header header;
+        std::memcpy(header.magic, MappedFormat::MAGIC, sizeof(header.magic));
+        header.version = MappedFormat::VERSION;
+        header.byteOrder = MappedFormat::ORDER_MARK;
+        header.reserved = 0;
+        header.root = this->serializeNode(result);
+        header.size = result.size();
+
+        std::memcpy(&result[0], &header, sizeof(header));
+        return result;
+    }
+
+    void Table::serialize(const std::string& path)
+    {
+        const std::string contents = this->serialize();
+
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+        if (!file)
+            throw std::runtime_error("Unable to write table file!");
+    }
+
+    MappedTable::MappedTable(const char* base, const size_t& size, const uint64_t& offset) : mBase(base), mSize(size)
+    {
+        uint64_t count = 0;
+
+        if (offset > size || size - offset < sizeof(count))
+            throw std::runtime_error("Corrupt table file!");
+
+        std::memcpy(&count, base + offset, sizeof(count));
+
+        if (count > (size - offset - sizeof(count)) / sizeof(MappedFormat::Entry))
+            throw std::runtime_error("Corrupt table file!");
+
+        mCount = static_cast<size_t>(count);
+        mEntries = base + offset + sizeof(count);
+    }
+
+    MappedFormat::Entry MappedTable::entry(const size_t& index) const
+    {
+        MappedFormat::Entry result;
+        std::memcpy(&result, mEntries + index * sizeof(MappedFormat::Entry), sizeof(result));
+        return result;
+    }
+
+    std::string_view MappedTable::string(const uint64_t& offset) const
+    {
+        uint32_t length = 0;
+
+        if (offset > mSize || mSize - offset < sizeof(length))
+            throw std::runtime_error("Corrupt table file!");
+
+        std::memcpy(&length, mBase + offset, sizeof(length));
+
+        if (mSize - offset - sizeof(length) < length)
+            throw std::runtime_error("Corrupt table file!");
+
+        return std::string_view(mBase + offset + sizeof(length), length);
+    }
+
+    std::string_view MappedTable::key(const MappedFormat::Entry& in) const
+    {
+        const std::string_view result = this->string(in.key);
+
+        if (result.size() != in.keyLength)
+            throw std::runtime_error("Corrupt table file!");
+
+        return result;
+    }
+
+    const char* MappedTable::find(const std::string_view& key) const
+    {
+        size_t low = 0;
+        size_t high = mCount;
+
+        while (low < high)
+        {
+            const size_t middle = low + (high - low) / 2;
+            const int comparison = this->key(this->entry(middle)).compare(key);
+
+            if (comparison == 0)
+                return mEntries + middle * sizeof(MappedFormat::Entry);
+            else if (comparison < 0)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        return nullptr;
+    }
+
+    MappedFormat::Entry MappedTable::expect(const std::string_view& key, const unsigned char& type) const
+    {
+        const char* found = this->find(key);
+
+        if (!found)
+            throw std::out_of_range("No such key!");
+
+        MappedFormat::Entry result;
+        std::memcpy(&result, found, sizeof(result));
+
+        if (result.type != type)
+            throw std::runtime_error("Mismatched types!");
+
+        return result;
+    }
+
+    unsigned char MappedTable::type(const std::string_view& key) const
+    {
+        const char* found = this->find(key);
+
+        if (!found)
+            throw std::out_of_range("No such key!");
+
+        MappedFormat::Entry result;
+        std::memcpy(&result, found, sizeof(result));
+        return result.type;
+    }
+
+    void MappedTable::get(const std::string_view& key, int& out) const
+    {
+        const MappedFormat::Entry found = this->expect(key, EASYLUA_INTEGER);
+
+        int64_t value = 0;
+        std::memcpy(&value, &found.value, sizeof(value));
+
+        if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max())
+            throw std::out_of_range("Integer does not fit into an int!");
+
+        out = static_cast<int>(value);
+    }
+
+    void MappedTable::get(const std::string_view& key, lua_Integer& out) const
+    {
+        const MappedFormat::Entry found = this->expect(key, EASYLUA_INTEGER);
+
+        int64_t value = 0;
+        std::memcpy(&value, &found.value, sizeof(value));
+        out = static_cast<lua_Integer>(value);
+    }
+
+    void MappedTable::get(const std::string_view& key, float& out) const
+    {
+        const MappedFormat::Entry found = this->expect(key, EASYLUA_FLOAT);
+        std::memcpy(&out, &found.value, sizeof(out));
+    }
+
+    void MappedTable::get(const std::string_view& key, std::string& out) const
+    {
+        out = std::string(this->string(this->expect(key, EASYLUA_STRING).value));
+    }
+
+    void MappedTable::get(const std::string_view& key, std::string_view& out) const
+    {
+        out = this->string(this->expect(key, EASYLUA_STRING).value);
+    }
+
+    void MappedTable::get(const std::string_view& key, MappedTable& out) const
+    {
+        out = MappedTable(mBase, mSize, this->expect(key, EASYLUA_TABLE).value);
+    }
+
+    void MappedTable::push(lua_State* lua) const
+    {
+        StackGuard guard(lua);
+        this->pushNode(lua, 0);
+        guard.release();
+    }
+
+    void MappedTable::pushNode(lua_State* lua, const unsigned int& depth) const
+    {
+        if (depth > MappedFormat::MAXIMUM_DEPTH)
+            throw std::runtime_error("Corrupt table file!");
+        if (!lua_checkstack(lua, 3))
+            throw std::runtime_error("Unable to grow the Lua stack!");
+
+        lua_createtable(lua, 0, static_cast<int>(mCount));
+
+        for (size_t index = 0; index < mCount; ++index)
+        {
+            const MappedFormat::Entry current = this->entry(index);
+            const std::string_view name = this->key(current);
+
+            lua_pushlstring(lua, name.data(), name.size());
+
+            switch (current.type)
+            {
+                case EASYLUA_INTEGER:
+                {
+                    int64_t value = 0;
+                    std::memcpy(&value, &current.value, sizeof(value));
+                    lua_pushinteger(lua, static_cast<lua_Integer>(value));
+                    break;
+                }
+
+                case EASYLUA_FLOAT:
+                {
+                    float value = 0;
+                    std::memcpy(&value, &current.value, sizeof(value));
+                    lua_pushnumber(lua, value);
+                    break;
+                }
+
+                case EASYLUA_STRING:
+                {
+                    const std::string_view value = this->string(current.value);
+                    lua_pushlstring(lua, value.data(), value.size());
+                    break;
+                }
+
+                case EASYLUA_TABLE:
+                {
+                    MappedTable(mBase, mSize, current.value).pushNode(lua, depth + 1);
+                    break;
+                }
+
+                default:
+                {
+                    lua_pushnil(lua);
+                    break;
+                }
+            }
+
+            lua_rawset(lua, -3);
+        }
+    }
+
+    TableMapping::TableMapping(const std::string& path) : mBase(nullptr), mSize(0)
+    {
+        #if defined(_WIN32)
+            std::ifstream file(path, std::ios::in | std::ios::binary);
+            if (!file)
+                throw std::runtime_error("Unable to open table file!");
+
+            mBuffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            mBase = mBuffer.data();
+            mSize = mBuffer.size();
+        #else
+            const int descriptor = open(path.c_str(), O_RDONLY);
+            if (descriptor < 0)
+                throw std::runtime_error("Unable to open table file!");
+
+            struct stat status;
+            if (fstat(descriptor, &status) != 0 || status.st_size <= 0)
+            {
+                close(descriptor);
+                throw std::runtime_error("Unable to map table file!");
+            }
+
+            void* mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+            close(descriptor);
+
+            if (mapping == MAP_FAILED)
+                throw std::runtime_error("Unable to map table file!");
+
+            mBase = reinterpret_cast<const char*>(mapping);
+            mSize = static_cast<size_t>(status.st_size);
+        #endif
+
+        MappedFormat::Header header;
+        bool valid = mSize >= sizeof(header);
+
+        if (valid)
+        {
+            std::memcpy(&header, mBase, sizeof(header));
+            valid = std::memcmp(header.magic, MappedFormat::MAGIC, sizeof(header.magic)) == 0 && header.version == MappedFormat::VERSION &&
+            header.byteOrder == MappedFormat::ORDER_MARK && header.size == mSize;
+        }
+
+        try
+        {
+            if (!valid)
+                throw std::runtime_error("Not a valid table file!");
+
+            mRoot = MappedTable(mBase, mSize, header.root);
+        }
+        catch (...)
+        {
+            #if !defined(_WIN32)
+                munmap(const_cast<char*>(mBase), mSize);
+            #endif
+            throw;
+        }
+    }
+
+    TableMapping::~TableMapping(void)
+    {
+        #if !defined(_WIN32)
+            munmap(const_cast<char*>(mBase), mSize);
+        #endif
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,130 @@
+/**
+ *  @file easylua_memoize.cpp
+ *  @brief Source file implementing the memoization cache for pure Lua functions.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_codec.hpp>
+#include <easylua_memoize.hpp>
+
+namespace EasyLua
+{
+    Memoizer::Memoizer(lua_State* lua, const size_t& capacity, const std::chrono::nanoseconds& timeToLive) : mLua(lua), mCapacity(capacity), mTimeToLive(timeToLive)
+    {
+        this->resetStatistics();
+    }
+
+    void Memoizer::setCacheable(const std::string& methodName, const bool& cacheable)
+    {
+        if (cacheable)
+            mCacheable.insert(methodName);
+        else if (mCacheable.erase(methodName) != 0)
+            this->clear(methodName);
+    }
+
+    void Memoizer::clear(void)
+    {
+        mEntries.clear();
+        mOrder.clear();
+    }
+
+    void Memoizer::clear(const std::string& methodName)
+    {
+        // Keys start with the function name and its terminator
+        for (auto it = mEntries.begin(); it != mEntries.end();)
+        {
+            const std::string& key = (*it).first;
+
+            if (key.size() > methodName.size() && key[methodName.size()] == '\0' && key.compare(0, methodName.size(), methodName) == 0)
+            {
+                mOrder.erase((*it).second);
+                it = mEntries.erase(it);
+            }
+            else
+                it++;
+        }
+    }
+
+    void Memoizer::resetStatistics(void)
+    {
+        mStatistics.hits = 0;
+        mStatistics.misses = 0;
+        mStatistics.evictions = 0;
+        mStatistics.expirations = 0;
+        mStatistics.uncacheable = 0;
+    }
+
+    std::pair<int, size_t> Memoizer::resolve(const char* methodName, const int& parameterCount, const bool& protect)
+    {
+        const int base = lua_gettop(mLua) - parameterCount;
+
+        std::string key(methodName);
+        key.push_back('\0');
+
+        if (!ValueCodec::encode(mLua, base + 1, parameterCount, key))
+        {
+            ++mStatistics.uncacheable;
+
+            if (protect)
+                return EasyLua::pcall(mLua, methodName, static_cast<EasyLua::ParameterCount>(parameterCount));
+            return std::make_pair(LUA_OK, static_cast<size_t>(EasyLua::call(mLua, methodName, static_cast<EasyLua::ParameterCount>(parameterCount))));
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        auto found = mEntries.find(key);
+
+        if (found != mEntries.end())
+        {
+            if (mTimeToLive == std::chrono::nanoseconds::zero() || now < (*(*found).second).expires)
+            {
+                ++mStatistics.hits;
+                mOrder.splice(mOrder.begin(), mOrder, (*found).second);
+
+                lua_settop(mLua, base);
+                return std::make_pair(LUA_OK, static_cast<size_t>(ValueCodec::decode(mLua, (*(*found).second).results)));
+            }
+
+            ++mStatistics.expirations;
+            mOrder.erase((*found).second);
+            mEntries.erase(found);
+        }
+
+        ++mStatistics.misses;
+
+        // The arguments are already in place, so call through the overloads taking a parameter count
+        std::pair<int, size_t> result;
+        if (protect)
+            result = EasyLua::pcall(mLua, methodName, static_cast<EasyLua::ParameterCount>(parameterCount));
+        else
+            result = std::make_pair(LUA_OK, static_cast<size_t>(EasyLua::call(mLua, methodName, static_cast<EasyLua::ParameterCount>(parameterCount))));
+
+        if (result.first != LUA_OK || mCapacity == 0)
+            return result;
+
+        std::string results;
+        if (!ValueCodec::encode(mLua, base + 1, static_cast<int>(result.second), results))
+        {
+            ++mStatistics.uncacheable;
+            return result;
+        }
+
+        auto inserted = mEntries.emplace(std::move(key), mOrder.end()).first;
+        mOrder.push_front(Entry{&(*inserted).first, std::move(results), now + mTimeToLive});
+        (*inserted).second = mOrder.begin();
+
+        while (mOrder.size() > mCapacity)
+        {
+            ++mStatistics.evictions;
+            mEntries.erase(*mOrder.back().key);
+            mOrder.pop_back();
+        }
+
+        return result;
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,128 @@
+/**
+ *  @file easylua_memory.cpp
+ *  @brief Source file implementing memory accounting for Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <cstdlib>
+#include <stdexcept>
+
+#include <easylua_memory.hpp>
+
+namespace EasyLua
+{
+    MemoryAccount::MemoryAccount(const size_t& hardLimit, const size_t& softLimit) : mCurrent(0), mPeak(0), mAllocations(0), mFrees(0), mFailures(0),
+    mHardLimit(hardLimit), mSoftLimit(softLimit), mSoftLimitReached(false)
+    {
+    }
+
+    lua_State* MemoryAccount::newState(void)
+    {
+        lua_State* lua = lua_newstate(MemoryAccount::allocate, this);
+
+        if (!lua)
+            throw std::runtime_error("Unable to create a state within the memory limit!");
+
+        lua_atpanic(lua, MemoryAccount::panic);
+        return lua;
+    }
+
+    MemoryAccount* MemoryAccount::get(lua_State* lua)
+    {
+        void* account = nullptr;
+
+        if (lua_getallocf(lua, &account) != MemoryAccount::allocate)
+            return nullptr;
+
+        return reinterpret_cast<MemoryAccount*>(account);
+    }
+
+    int MemoryAccount::panic(lua_State* lua)
+    {
+        MemoryAccount* self = MemoryAccount::get(lua);
+
+        if (self && self->mPanicCallback)
+        {
+            const char* message = lua_tostring(lua, -1);
+            self->mPanicCallback(*self, message ? message : "(error object is not a string)");
+        }
+        return 0;
+    }
+
+    void* MemoryAccount::allocate(void* account, void* memory, size_t oldSize, size_t newSize)
+    {
+        MemoryAccount* self = reinterpret_cast<MemoryAccount*>(account);
+
+        // When memory is nullptr, oldSize encodes the kind of object rather than a size
+        if (!memory)
+            oldSize = 0;
+
+        if (newSize == 0)
+        {
+            std::free(memory);
+
+            if (memory)
+            {
+                const size_t current = self->mCurrent.fetch_sub(oldSize, std::memory_order_relaxed) - oldSize;
+                self->mFrees.fetch_add(1, std::memory_order_relaxed);
+
+                const size_t softLimit = self->mSoftLimit.load(std::memory_order_relaxed);
+                if (current < softLimit)
+                    self->mSoftLimitReached.store(false, std::memory_order_relaxed);
+            }
+
+            return nullptr;
+        }
+
+        // Shrinking never fails, so only growth is charged up front
+        const size_t growth = newSize > oldSize ? newSize - oldSize : 0;
+        const size_t previous = self->mCurrent.fetch_add(growth, std::memory_order_relaxed);
+
+        const size_t hardLimit = self->mHardLimit.load(std::memory_order_relaxed);
+        if (growth != 0 && hardLimit != 0 && previous + growth > hardLimit)
+        {
+            self->mCurrent.fetch_sub(growth, std::memory_order_relaxed);
+            self->mFailures.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        void* result = std::realloc(memory, newSize);
+
+        if (!result)
+        {
+            self->mCurrent.fetch_sub(growth, std::memory_order_relaxed);
+            self->mFailures.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        if (!memory)
+            self->mAllocations.fetch_add(1, std::memory_order_relaxed);
+
+        size_t current = previous + growth;
+        if (newSize < oldSize)
+            current = self->mCurrent.fetch_sub(oldSize - newSize, std::memory_order_relaxed) - (oldSize - newSize);
+
+        size_t peak = self->mPeak.load(std::memory_order_relaxed);
+        while (current > peak && !self->mPeak.compare_exchange_weak(peak, current, std::memory_order_relaxed));
+
+        const size_t softLimit = self->mSoftLimit.load(std::memory_order_relaxed);
+        if (softLimit != 0)
+        {
+            if (current >= softLimit)
+            {
+                if (!self->mSoftLimitReached.exchange(true, std::memory_order_relaxed) && self->mSoftLimitCallback)
+                    self->mSoftLimitCallback(*self);
+            }
+            else
+                self->mSoftLimitReached.store(false, std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+} // End NameSpace EasyLua
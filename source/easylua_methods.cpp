@@ -0,0 +1,122 @@
+/**
+ *  @file easylua_methods.cpp
+ *  @brief Source file implementing cached object and method references.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <algorithm>
+
+#include <easylua_methods.hpp>
+
+namespace EasyLua
+{
+    ObjectRef::ObjectRef(lua_State* lua, const int& index, ScriptReloader* reloader) : mLua(lua), mReference(LUA_NOREF), mReloader(reloader)
+    {
+        lua_pushvalue(lua, index);
+        mReference = luaL_ref(lua, LUA_REGISTRYINDEX);
+    }
+
+    ObjectRef::~ObjectRef(void)
+    {
+        this->invalidate();
+    }
+
+    void ObjectRef::invalidate(void)
+    {
+        for (MethodRef* method : mMethods)
+        {
+            method->release();
+            method->mObject = nullptr;
+        }
+        mMethods.clear();
+
+        if (mReference != LUA_NOREF)
+            luaL_unref(mLua, LUA_REGISTRYINDEX, mReference);
+
+        mReference = LUA_NOREF;
+    }
+
+    void ObjectRef::push(void)
+    {
+        if (mReference == LUA_NOREF)
+            throw std::runtime_error("Attempted to use an invalidated object!");
+
+        lua_rawgeti(mLua, LUA_REGISTRYINDEX, mReference);
+    }
+
+    MethodRef::MethodRef(ObjectRef& object, const std::string& name) : mObject(&object), mName(name), mGeneration(0), mReference(LUA_NOREF)
+    {
+        // Binding to an invalidated object yields an invalidated method straight away
+        if (object.isValid())
+            object.mMethods.push_back(this);
+        else
+            mObject = nullptr;
+    }
+
+    MethodRef::~MethodRef(void)
+    {
+        if (!mObject)
+            return;
+
+        this->release();
+
+        std::vector<MethodRef*>& methods = mObject->mMethods;
+        methods.erase(std::find(methods.begin(), methods.end(), this));
+    }
+
+    void MethodRef::release(void)
+    {
+        if (mReference != LUA_NOREF)
+            luaL_unref(mObject->mLua, LUA_REGISTRYINDEX, mReference);
+
+        mReference = LUA_NOREF;
+    }
+
+    void MethodRef::push(void)
+    {
+        if (!mObject)
+            throw std::runtime_error("Attempted to call a method of an invalidated object!");
+
+        lua_State* lua = mObject->mLua;
+
+        if (mObject->mReloader)
+        {
+            const uint64_t generation = mObject->mReloader->generation(lua);
+
+            if (generation != mGeneration)
+            {
+                this->release();
+                mGeneration = generation;
+            }
+        }
+
+        if (mReference == LUA_NOREF)
+        {
+            // Look the method up through the object so that __index chains are honored once
+            mObject->push();
+            lua_getfield(lua, -1, mName.c_str());
+
+            if (lua_isnil(lua, -1))
+            {
+                lua_pop(lua, 2);
+                throw std::runtime_error("Attempted to call a method that does not exist: " + mName);
+            }
+
+            lua_pushvalue(lua, -1);
+            mReference = luaL_ref(lua, LUA_REGISTRYINDEX);
+
+            // Order as method, self
+            lua_insert(lua, -2);
+            return;
+        }
+
+        lua_rawgeti(lua, LUA_REGISTRYINDEX, mReference);
+        lua_rawgeti(lua, LUA_REGISTRYINDEX, mObject->mReference);
+    }
+} // End NameSpace EasyLua
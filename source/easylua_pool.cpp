@@ -0,0 +1,257 @@
+/**
+ *  @file easylua_pool.cpp
+ *  @brief Source file implementing pools of recyclable Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <stdexcept>
+
+#include <easylua_pool.hpp>
+
+namespace EasyLua
+{
+    //! The registry key the snapshot is stored under.
+    static const char sSnapshotKey = 0;
+
+    /**
+     *  @brief Restores the contents of a table from its copy.
+     *  @param lua The state to operate on.
+     *  @param table The absolute stack index of the table.
+     *  @param copy The absolute stack index of the copy.
+     */
+    static void restoreTable(lua_State* lua, const int& table, const int& copy)
+    {
+        // Drop everything added since; assigning nil to existing fields is allowed while traversing
+        lua_pushnil(lua);
+        while (lua_next(lua, table) != 0)
+        {
+            lua_pop(lua, 1);
+
+            lua_pushvalue(lua, -1);
+            if (lua_rawget(lua, copy) == LUA_TNIL)
+            {
+                lua_pushvalue(lua, -2);
+                lua_pushnil(lua);
+                lua_rawset(lua, table);
+            }
+
+            lua_pop(lua, 1);
+        }
+
+        // Put back everything that was replaced or removed
+        lua_pushnil(lua);
+        while (lua_next(lua, copy) != 0)
+        {
+            lua_pushvalue(lua, -2);
+            lua_pushvalue(lua, -2);
+            lua_rawset(lua, table);
+            lua_pop(lua, 1);
+        }
+    }
+
+    StatePool::StatePool(const std::function<void(lua_State*)>& setup, const size_t& maximumIdle, const unsigned int& depth, const int& stepSize) :
+    mSetup(setup), mMaximumIdle(maximumIdle), mDepth(depth), mStepSize(stepSize)
+    {
+    }
+
+    StatePool::~StatePool(void)
+    {
+        for (auto it = mIdle.begin(); it != mIdle.end(); it++)
+            lua_close(*it);
+    }
+
+    lua_State* StatePool::create(void)
+    {
+        lua_State* lua = luaL_newstate();
+
+        try
+        {
+            mSetup(lua);
+        }
+        catch (...)
+        {
+            lua_close(lua);
+            throw;
+        }
+
+        lua_settop(lua, 0);
+        StatePool::snapshot(lua, mDepth);
+
+        // The snapshot and whatever setup left behind are here to stay
+        lua_gc(lua, LUA_GCCOLLECT, 0);
+        return lua;
+    }
+
+    lua_State* StatePool::acquire(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (!mIdle.empty())
+            {
+                lua_State* result = mIdle.back();
+                mIdle.pop_back();
+                return result;
+            }
+        }
+
+        return this->create();
+    }
+
+    void StatePool::release(lua_State* lua)
+    {
+        StatePool::reset(lua, mStepSize);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            if (mIdle.size() < mMaximumIdle)
+            {
+                mIdle.push_back(lua);
+                return;
+            }
+        }
+
+        lua_close(lua);
+    }
+
+    void StatePool::reserve(const size_t& count)
+    {
+        while (this->idle() < count)
+        {
+            lua_State* lua = this->create();
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            mIdle.push_back(lua);
+        }
+    }
+
+    size_t StatePool::idle(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mIdle.size();
+    }
+
+    void StatePool::snapshot(lua_State* lua, const unsigned int& depth)
+    {
+        const int top = lua_gettop(lua);
+
+        // holder = { [1] = original -> copy, [2] = original -> metatable or false }
+        lua_createtable(lua, 2, 0);
+        const int holder = top + 1;
+        lua_newtable(lua);
+        const int contents = top + 2;
+        lua_newtable(lua);
+        const int metatables = top + 3;
+
+        lua_pushvalue(lua, contents);
+        lua_rawseti(lua, holder, 1);
+        lua_pushvalue(lua, metatables);
+        lua_rawseti(lua, holder, 2);
+
+        // Stored before copying so that the registry copy keeps it
+        lua_pushvalue(lua, holder);
+        lua_rawsetp(lua, LUA_REGISTRYINDEX, &sSnapshotKey);
+
+        // Breadth first over the tables reachable from the registry
+        lua_newtable(lua);
+        const int queue = top + 4;
+        std::vector<unsigned int> levels;
+
+        lua_pushvalue(lua, LUA_REGISTRYINDEX);
+        lua_rawseti(lua, queue, 1);
+        levels.push_back(1);
+
+        for (size_t index = 0; index < levels.size(); ++index)
+        {
+            lua_rawgeti(lua, queue, static_cast<lua_Integer>(index + 1));
+            const int table = lua_gettop(lua);
+
+            lua_pushvalue(lua, table);
+            const bool seen = lua_rawget(lua, contents) != LUA_TNIL;
+            lua_pop(lua, 1);
+
+            if (seen || lua_rawequal(lua, table, holder))
+            {
+                lua_pop(lua, 1);
+                continue;
+            }
+
+            lua_newtable(lua);
+            const int copy = lua_gettop(lua);
+
+            lua_pushnil(lua);
+            while (lua_next(lua, table) != 0)
+            {
+                if (lua_type(lua, -1) == LUA_TTABLE && levels[index] < depth)
+                {
+                    lua_pushvalue(lua, -1);
+                    lua_rawseti(lua, queue, static_cast<lua_Integer>(levels.size() + 1));
+                    levels.push_back(levels[index] + 1);
+                }
+
+                lua_pushvalue(lua, -2);
+                lua_insert(lua, -2);
+                lua_rawset(lua, copy);
+            }
+
+            lua_pushvalue(lua, table);
+            lua_insert(lua, -2);
+            lua_rawset(lua, contents);
+
+            lua_pushvalue(lua, table);
+            if (!lua_getmetatable(lua, table))
+                lua_pushboolean(lua, 0);
+            lua_rawset(lua, metatables);
+
+            lua_pop(lua, 1);
+        }
+
+        lua_settop(lua, top);
+    }
+
+    void StatePool::reset(lua_State* lua, const int& stepSize)
+    {
+        lua_settop(lua, 0);
+
+        if (lua_rawgetp(lua, LUA_REGISTRYINDEX, &sSnapshotKey) != LUA_TTABLE)
+        {
+            lua_pop(lua, 1);
+            throw std::runtime_error("State was never snapshotted!");
+        }
+
+        const int holder = lua_gettop(lua);
+        lua_rawgeti(lua, holder, 1);
+        const int contents = holder + 1;
+        lua_rawgeti(lua, holder, 2);
+        const int metatables = holder + 2;
+
+        lua_pushnil(lua);
+        while (lua_next(lua, contents) != 0)
+        {
+            restoreTable(lua, lua_absindex(lua, -2), lua_absindex(lua, -1));
+            lua_pop(lua, 1);
+        }
+
+        lua_pushnil(lua);
+        while (lua_next(lua, metatables) != 0)
+        {
+            if (lua_type(lua, -1) == LUA_TBOOLEAN)
+            {
+                lua_pop(lua, 1);
+                lua_pushnil(lua);
+            }
+
+            lua_setmetatable(lua, -2);
+        }
+
+        lua_settop(lua, 0);
+        lua_gc(lua, LUA_GCSTEP, stepSize);
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,303 @@
+/**
+ *  @file easylua_recorder.cpp
+ *  @brief Source file implementing the call recorder and the offline replayer.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <easylua_codec.hpp>
+#include <easylua_recorder.hpp>
+
+namespace EasyLua
+{
+    //! The registry key the recorder attached to a state is stored at.
+    static const char sRecorderKey = 0;
+
+    std::atomic<unsigned int> Resolvers::CallRecording::sActive(0);
+
+    /**
+     *  @brief Marks a recorder as inside a recorded call for as long as the guard exists, including when the
+     *  call unwinds.
+     */
+    struct RecorderDepthGuard
+    {
+        //! The depth being guarded.
+        int& depth;
+
+        /**
+         *  @brief Constructor entering the call.
+         *  @param target The depth to guard.
+         */
+        RecorderDepthGuard(int& target) : depth(target) { ++depth; }
+
+        //! Standard destructor leaving the call.
+        ~RecorderDepthGuard(void) { --depth; }
+    };
+
+    int Resolvers::CallRecording::invoke(lua_State* lua, const char* methodName, const int& parameterCount, const int& errorHandler, const bool& protect)
+    {
+        lua_rawgetp(lua, LUA_REGISTRYINDEX, &sRecorderKey);
+        Recorder* recorder = reinterpret_cast<Recorder*>(lua_touserdata(lua, -1));
+        lua_pop(lua, 1);
+
+        // Calls made from within a recorded call are part of its duration and replayed along with it
+        if (!recorder || recorder->mDepth != 0)
+        {
+            if (protect)
+                return lua_pcall(lua, parameterCount, LUA_MULTRET, errorHandler);
+
+            lua_call(lua, parameterCount, LUA_MULTRET);
+            return LUA_OK;
+        }
+
+        RecordedCall call;
+        call.name = methodName;
+        call.parameterCount = static_cast<uint32_t>(parameterCount);
+        call.duration = std::chrono::nanoseconds::zero();
+        call.status = LUA_OK;
+
+        if (parameterCount > 0)
+            ValueCodec::encode(lua, -parameterCount, parameterCount, call.parameters);
+
+        // Scripts may cause further calls to be recorded, so the entry is addressed by position
+        const size_t position = recorder->mCalls.size();
+        recorder->mCalls.push_back(std::move(call));
+
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+        int status;
+
+        {
+            RecorderDepthGuard depth(recorder->mDepth);
+
+            start = std::chrono::steady_clock::now();
+            status = lua_pcall(lua, parameterCount, LUA_MULTRET, protect ? errorHandler : 0);
+            end = std::chrono::steady_clock::now();
+        }
+
+        recorder->mCalls[position].duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+        recorder->mCalls[position].status = status;
+
+        if (!protect && status != LUA_OK)
+            lua_error(lua);
+
+        return status;
+    }
+
+    Recorder::Recorder(lua_State* lua) : mLua(lua), mDepth(0)
+    {
+        const bool attached = lua_rawgetp(lua, LUA_REGISTRYINDEX, &sRecorderKey) != LUA_TNIL;
+        lua_pop(lua, 1);
+
+        if (attached)
+            throw std::runtime_error("A recorder is already attached to this state!");
+
+        lua_pushlightuserdata(lua, this);
+        lua_rawsetp(lua, LUA_REGISTRYINDEX, &sRecorderKey);
+
+        Resolvers::CallRecording::sActive.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Recorder::~Recorder(void)
+    {
+        lua_pushnil(mLua);
+        lua_rawsetp(mLua, LUA_REGISTRYINDEX, &sRecorderKey);
+
+        Resolvers::CallRecording::sActive.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     *  @brief Reads the raw bytes of a value.
+     *  @param log The log to read from.
+     *  @param offset The offset to read at, advanced past the value.
+     *  @param size The number of bytes to read.
+     *  @param out Where to write the bytes.
+     *  @throw std::runtime_error Thrown when the log ends early.
+     */
+    static void readRaw(const std::string& log, size_t& offset, const size_t& size, void* out)
+    {
+        if (log.size() - offset < size)
+            throw std::runtime_error("Truncated call log!");
+
+        std::memcpy(out, log.data() + offset, size);
+        offset += size;
+    }
+
+    /**
+     *  @brief Reads a 32-bit length prefixed string.
+     *  @param log The log to read from.
+     *  @param offset The offset to read at, advanced past the string.
+     *  @return The string.
+     *  @throw std::runtime_error Thrown when the log ends early.
+     */
+    static std::string readString(const std::string& log, size_t& offset)
+    {
+        uint32_t length = 0;
+        readRaw(log, offset, sizeof(length), &length);
+
+        if (log.size() - offset < length)
+            throw std::runtime_error("Truncated call log!");
+
+        std::string result = log.substr(offset, length);
+        offset += length;
+        return result;
+    }
+
+    std::string Recorder::serialize(void) const
+    {
+        RecorderFormat::Header header;
+        std::memcpy(header.magic, RecorderFormat::MAGIC, sizeof(header.magic));
+        header.version = RecorderFormat::VERSION;
+        header.byteOrder = RecorderFormat::ORDER_MARK;
+        header.count = static_cast<uint32_t>(mCalls.size());
+
+        std::string result;
+        ValueCodec::writeRaw(result, header);
+
+        for (auto it = mCalls.begin(); it != mCalls.end(); it++)
+        {
+            ValueCodec::writeRaw(result, static_cast<uint32_t>((*it).name.size()));
+            result.append((*it).name);
+            ValueCodec::writeRaw(result, (*it).parameterCount);
+            ValueCodec::writeRaw(result, static_cast<uint32_t>((*it).parameters.size()));
+            result.append((*it).parameters);
+            ValueCodec::writeRaw(result, static_cast<int64_t>((*it).duration.count()));
+            ValueCodec::writeRaw(result, static_cast<int32_t>((*it).status));
+        }
+
+        return result;
+    }
+
+    void Recorder::serialize(const std::string& path) const
+    {
+        const std::string contents = this->serialize();
+
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+        if (!file)
+            throw std::runtime_error("Unable to write call log!");
+    }
+
+    Replayer::Replayer(const std::string& log)
+    {
+        size_t offset = 0;
+
+        RecorderFormat::Header header;
+        readRaw(log, offset, sizeof(header), &header);
+
+        if (std::memcmp(header.magic, RecorderFormat::MAGIC, sizeof(header.magic)) != 0)
+            throw std::runtime_error("Not a call log!");
+        else if (header.byteOrder != RecorderFormat::ORDER_MARK)
+            throw std::runtime_error("Call log was written with a different byte order!");
+        else if (header.version != RecorderFormat::VERSION)
+            throw std::runtime_error("Unsupported call log version!");
+
+        for (uint32_t index = 0; index < header.count; ++index)
+        {
+            RecordedCall call;
+            call.name = readString(log, offset);
+            readRaw(log, offset, sizeof(call.parameterCount), &call.parameterCount);
+            call.parameters = readString(log, offset);
+
+            int64_t duration = 0;
+            readRaw(log, offset, sizeof(duration), &duration);
+            call.duration = std::chrono::nanoseconds(duration);
+
+            int32_t status = 0;
+            readRaw(log, offset, sizeof(status), &status);
+            call.status = status;
+
+            mCalls.push_back(std::move(call));
+        }
+    }
+
+    Replayer Replayer::load(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        if (!file)
+            throw std::runtime_error("Unable to open call log!");
+
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        return Replayer(contents.str());
+    }
+
+    std::map<std::string, ReplayStatistics> Replayer::replay(lua_State* lua, const size_t& iterations) const
+    {
+        std::map<std::string, ReplayStatistics> result;
+        const int top = lua_gettop(lua);
+
+        for (size_t iteration = 0; iteration < iterations; ++iteration)
+        {
+            for (auto it = mCalls.begin(); it != mCalls.end(); it++)
+            {
+                lua_getglobal(lua, (*it).name.c_str());
+
+                int parameterCount = 0;
+                try
+                {
+                    parameterCount = ValueCodec::decode(lua, (*it).parameters);
+                }
+                catch (...)
+                {
+                    lua_settop(lua, top);
+                    throw;
+                }
+
+                // Bypasses the call layer so replays are never recorded themselves
+                const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                const int status = lua_pcall(lua, parameterCount, LUA_MULTRET, 0);
+                const std::chrono::nanoseconds duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+                lua_settop(lua, top);
+
+                ReplayStatistics& statistics = result[(*it).name];
+                ++statistics.calls;
+                statistics.recorded += (*it).duration;
+                statistics.replayed += duration;
+                statistics.fastest = std::min(statistics.fastest, duration);
+                statistics.slowest = std::max(statistics.slowest, duration);
+
+                if (status != LUA_OK)
+                    ++statistics.failures;
+            }
+        }
+
+        return result;
+    }
+
+    std::string Replayer::report(const std::map<std::string, ReplayStatistics>& statistics)
+    {
+        std::string result;
+        char line[512];
+
+        snprintf(line, sizeof(line), "%-32s %10s %10s %14s %14s %9s\n", "function", "calls", "failures", "recorded (us)", "replayed (us)", "change");
+        result += line;
+
+        for (auto it = statistics.begin(); it != statistics.end(); it++)
+        {
+            const ReplayStatistics& current = (*it).second;
+            const double calls = current.calls ? static_cast<double>(current.calls) : 1.0;
+            const double recorded = std::chrono::duration<double, std::micro>(current.recorded).count() / calls;
+            const double replayed = std::chrono::duration<double, std::micro>(current.replayed).count() / calls;
+            const double change = recorded > 0.0 ? (replayed - recorded) / recorded * 100.0 : 0.0;
+
+            snprintf(line, sizeof(line), "%-32s %10zu %10zu %14.3f %14.3f %+8.1f%%\n", (*it).first.c_str(), current.calls, current.failures, recorded, replayed, change);
+            result += line;
+        }
+
+        return result;
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,334 @@
+/**
+ *  @file easylua_reload.cpp
+ *  @brief Source file implementing background script hot-reloading.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+#include <easylua_reload.hpp>
+
+namespace EasyLua
+{
+    /**
+     *  @brief Appends chunks produced by lua_dump to a string.
+     */
+    static int writeChunk(lua_State* lua, const void* data, size_t size, void* out)
+    {
+        reinterpret_cast<std::string*>(out)->append(reinterpret_cast<const char*>(data), size);
+        return 0;
+    }
+
+    /**
+     *  @brief Reads a file in its entirety.
+     *  @param path The file to read.
+     *  @param out Receives the contents.
+     *  @return True on success.
+     */
+    static bool readFile(const std::string& path, std::string& out)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        if (!file)
+            return false;
+
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        out = contents.str();
+        return true;
+    }
+
+    ScriptReloader::ScriptReloader(const std::chrono::milliseconds& interval) : mCompiler(luaL_newstate()), mGeneration(0), mInterval(interval), mRunning(false)
+    {
+    }
+
+    ScriptReloader::~ScriptReloader(void)
+    {
+        this->stop();
+        lua_close(mCompiler);
+    }
+
+    void ScriptReloader::watch(const std::string& path, const bool& initial)
+    {
+        Script script;
+        script.path = path;
+        script.modified = std::filesystem::file_time_type::min();
+        script.size = 0;
+        script.hash = 0;
+        script.generation = 0;
+
+        std::string source;
+        if (!initial && readFile(path, source))
+        {
+            std::error_code error;
+            script.modified = std::filesystem::last_write_time(path, error);
+            script.size = source.size();
+            script.hash = std::hash<std::string>()(source);
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        mScripts.push_back(std::move(script));
+    }
+
+    void ScriptReloader::start(void)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        if (mRunning)
+            return;
+
+        mRunning = true;
+        mThread = std::thread([this]()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+
+            while (mRunning)
+            {
+                lock.unlock();
+                this->poll();
+                lock.lock();
+
+                mWake.wait_for(lock, mInterval, [this]() { return !mRunning; });
+            }
+        });
+    }
+
+    void ScriptReloader::stop(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunning = false;
+        }
+
+        mWake.notify_all();
+
+        if (mThread.joinable())
+            mThread.join();
+    }
+
+    bool ScriptReloader::compile(const std::string& path, const std::string& source, std::string& bytecode, std::string& error)
+    {
+        std::lock_guard<std::mutex> lock(mCompileMutex);
+
+        const std::string chunkName = "@" + path;
+
+        if (luaL_loadbufferx(mCompiler, source.data(), source.size(), chunkName.c_str(), "t") != LUA_OK)
+        {
+            error = lua_tostring(mCompiler, -1);
+            lua_pop(mCompiler, 1);
+            return false;
+        }
+
+        bytecode.clear();
+        lua_dump(mCompiler, writeChunk, &bytecode, 0);
+        lua_pop(mCompiler, 1);
+        return true;
+    }
+
+    size_t ScriptReloader::poll(void)
+    {
+        std::vector<std::pair<std::string, std::filesystem::file_time_type>> candidates;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            for (auto it = mScripts.begin(); it != mScripts.end(); it++)
+                candidates.push_back(std::make_pair((*it).path, (*it).modified));
+        }
+
+        size_t compiled = 0;
+
+        for (auto it = candidates.begin(); it != candidates.end(); it++)
+        {
+            const std::string& path = (*it).first;
+
+            std::error_code status;
+            const std::filesystem::file_time_type modified = std::filesystem::last_write_time(path, status);
+            if (status || modified == (*it).second)
+                continue;
+
+            std::string source;
+            if (!readFile(path, source))
+                continue;
+
+            const size_t hash = std::hash<std::string>()(source);
+
+            std::string bytecode;
+            std::string error;
+            bool unchanged = false;
+
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+
+                for (auto script = mScripts.begin(); script != mScripts.end(); script++)
+                {
+                    if ((*script).path == path && (*script).size == source.size() && (*script).hash == hash && (*script).generation != 0)
+                    {
+                        // Touched but not changed
+                        (*script).modified = modified;
+                        unchanged = true;
+                    }
+                }
+            }
+
+            if (unchanged)
+                continue;
+
+            const bool success = this->compile(path, source, bytecode, error);
+
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            for (auto script = mScripts.begin(); script != mScripts.end(); script++)
+            {
+                if ((*script).path != path)
+                    continue;
+
+                (*script).modified = modified;
+                (*script).error = error;
+
+                if (success)
+                {
+                    (*script).size = source.size();
+                    (*script).hash = hash;
+                    (*script).bytecode = std::make_shared<const std::string>(std::move(bytecode));
+                    (*script).generation = mGeneration.load() + 1;
+                    mGeneration.store((*script).generation, std::memory_order_release);
+
+                    ++compiled;
+                }
+
+                break;
+            }
+        }
+
+        return compiled;
+    }
+
+    uint64_t ScriptReloader::generation(lua_State* lua)
+    {
+        lua_rawgetp(lua, LUA_REGISTRYINDEX, this);
+        const uint64_t result = static_cast<uint64_t>(lua_tointeger(lua, -1));
+        lua_pop(lua, 1);
+
+        return result;
+    }
+
+    size_t ScriptReloader::update(lua_State* lua, std::string* error)
+    {
+        const uint64_t latest = mGeneration.load(std::memory_order_acquire);
+        const uint64_t applied = this->generation(lua);
+
+        if (applied == latest)
+            return 0;
+
+        // Take what is new under the lock, but execute outside of it
+        std::vector<std::pair<uint64_t, std::pair<std::string, std::shared_ptr<const std::string>>>> pending;
+        uint64_t target = applied;
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+
+            for (auto it = mScripts.begin(); it != mScripts.end(); it++)
+                if ((*it).bytecode && (*it).generation > applied)
+                    pending.push_back(std::make_pair((*it).generation, std::make_pair((*it).path, (*it).bytecode)));
+
+            target = mGeneration.load(std::memory_order_acquire);
+        }
+
+        std::sort(pending.begin(), pending.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        size_t installed = 0;
+
+        for (auto it = pending.begin(); it != pending.end(); it++)
+        {
+            const std::string& path = (*it).second.first;
+            const std::string& bytecode = *(*it).second.second;
+            const std::string chunkName = "@" + path;
+
+            if (luaL_loadbufferx(lua, bytecode.data(), bytecode.size(), chunkName.c_str(), "b") != LUA_OK || lua_pcall(lua, 0, 0, 0) != LUA_OK)
+            {
+                if (error)
+                {
+                    error->append(lua_tostring(lua, -1));
+                    error->append("\n");
+                }
+
+                lua_pop(lua, 1);
+                continue;
+            }
+
+            ++installed;
+        }
+
+        lua_pushinteger(lua, static_cast<lua_Integer>(target));
+        lua_rawsetp(lua, LUA_REGISTRYINDEX, this);
+
+        return installed;
+    }
+
+    std::string ScriptReloader::error(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (auto it = mScripts.begin(); it != mScripts.end(); it++)
+            if ((*it).path == path)
+                return (*it).error;
+
+        return "";
+    }
+
+    FunctionRef::FunctionRef(lua_State* lua, const std::string& name, ScriptReloader* reloader) : mLua(lua), mName(name), mReloader(reloader),
+    mGeneration(0), mReference(LUA_NOREF)
+    {
+    }
+
+    FunctionRef::~FunctionRef(void)
+    {
+        this->invalidate();
+    }
+
+    void FunctionRef::invalidate(void)
+    {
+        if (mReference != LUA_NOREF)
+            luaL_unref(mLua, LUA_REGISTRYINDEX, mReference);
+
+        mReference = LUA_NOREF;
+    }
+
+    void FunctionRef::push(void)
+    {
+        if (mReloader)
+        {
+            const uint64_t generation = mReloader->generation(mLua);
+
+            if (generation != mGeneration)
+            {
+                this->invalidate();
+                mGeneration = generation;
+            }
+        }
+
+        if (mReference == LUA_NOREF)
+        {
+            lua_getglobal(mLua, mName.c_str());
+
+            // Missing functions are looked up again on the next push, as a script may still define them
+            if (!lua_isnil(mLua, -1))
+            {
+                lua_pushvalue(mLua, -1);
+                mReference = luaL_ref(mLua, LUA_REGISTRYINDEX);
+            }
+            return;
+        }
+
+        lua_rawgeti(mLua, LUA_REGISTRYINDEX, mReference);
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,438 @@
+/**
+ *  @file easylua_snapshot.cpp
+ *  @brief Source file implementing immutable Table snapshots and their publication.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_snapshot.hpp>
+
+namespace EasyLua
+{
+    uint64_t Snapshot::hash(const std::string_view& key)
+    {
+        return EasyLua::Utilities::hashKey(key);
+    }
+
+    std::unique_ptr<Snapshot> Snapshot::build(Table& table)
+    {
+        std::unique_ptr<Snapshot> result(new Snapshot());
+
+        // Tables are numbered in the order they are discovered, so node N is always pending[N]
+        std::vector<Table*> pending;
+        pending.push_back(&table);
+
+        for (size_t current = 0; current < pending.size(); ++current)
+        {
+            Table* source = pending[current];
+            const size_t count = source->mTypes.size();
+
+            // Keep the load factor at or below one half
+            uint32_t slotCount = 1;
+            while (slotCount < count * 2)
+                slotCount <<= 1;
+
+            Node node;
+            node.firstSlot = static_cast<uint32_t>(result->mSlots.size());
+            node.slotCount = slotCount;
+            node.entryCount = static_cast<uint32_t>(count);
+            result->mNodes.push_back(node);
+
+            Entry empty;
+            empty.hash = 0;
+            empty.keyOffset = 0;
+            empty.keyLength = 0;
+            empty.type = EMPTY;
+            empty.integer = 0;
+            result->mSlots.resize(result->mSlots.size() + slotCount, empty);
+
+            for (auto it = source->mTypes.begin(); it != source->mTypes.end(); it++)
+            {
+                const std::string& name = it->first;
+                void* memory = source->mContents[name];
+
+                Entry entry;
+                entry.hash = Snapshot::hash(name);
+                entry.keyOffset = static_cast<uint32_t>(result->mStrings.size());
+                entry.keyLength = static_cast<uint32_t>(name.size());
+                entry.type = it->second.second;
+                result->mStrings.append(name);
+
+                switch (entry.type)
+                {
+                    case EASYLUA_INTEGER:
+                    {
+                        entry.integer = *reinterpret_cast<int*>(memory);
+                        break;
+                    }
+
+                    case EASYLUA_FLOAT:
+                    {
+                        entry.number = *reinterpret_cast<float*>(memory);
+                        break;
+                    }
+
+                    case EASYLUA_STRING:
+                    {
+                        const std::string* value = reinterpret_cast<std::string*>(memory);
+
+                        entry.string.offset = static_cast<uint32_t>(result->mStrings.size());
+                        entry.string.length = static_cast<uint32_t>(value->size());
+                        result->mStrings.append(*value);
+                        break;
+                    }
+
+                    case EASYLUA_TABLE:
+                    {
+                        entry.node = static_cast<uint32_t>(pending.size());
+                        pending.push_back(reinterpret_cast<Table*>(memory));
+                        break;
+                    }
+                }
+
+                uint32_t slot = static_cast<uint32_t>(entry.hash) & (slotCount - 1);
+                while (result->mSlots[node.firstSlot + slot].type != EMPTY)
+                    slot = (slot + 1) & (slotCount - 1);
+
+                result->mSlots[node.firstSlot + slot] = entry;
+            }
+        }
+
+        return result;
+    }
+
+    const Snapshot::Entry* Snapshot::find(const uint32_t& node, const std::string_view& key) const
+    {
+        const Node& table = mNodes[node];
+        const uint64_t keyHash = Snapshot::hash(key);
+        const uint32_t mask = table.slotCount - 1;
+
+        for (uint32_t slot = static_cast<uint32_t>(keyHash) & mask;; slot = (slot + 1) & mask)
+        {
+            const Entry& entry = mSlots[table.firstSlot + slot];
+
+            if (entry.type == EMPTY)
+                return nullptr;
+            if (entry.hash == keyHash && this->key(entry) == key)
+                return &entry;
+        }
+    }
+
+    const Snapshot::Entry* Snapshot::next(const uint32_t& node, uint32_t slot) const
+    {
+        const Node& table = mNodes[node];
+
+        for (; slot < table.slotCount; ++slot)
+            if (mSlots[table.firstSlot + slot].type != EMPTY)
+                return &mSlots[table.firstSlot + slot];
+
+        return nullptr;
+    }
+
+    /**
+     *  @brief The userdata and metamethods backing SnapshotStore::push.
+     */
+    struct SnapshotProxy
+    {
+        //! The registry name of the proxy metatable.
+        static constexpr const char* METATABLE = "EasyLua.SnapshotProxy";
+
+        //! The registry name of the metatable of per-state reader registrations.
+        static constexpr const char* READER_METATABLE = "EasyLua.SnapshotReader";
+
+        //! A per-state reader registration, kept in the registry under the store's address.
+        struct Registration
+        {
+            SnapshotStore* store;
+            EpochDomain::Reader* reader;
+        };
+
+        //! The store being read.
+        SnapshotStore* store;
+
+        //! The reader slot of the state this proxy lives in.
+        EpochDomain::Reader* reader;
+
+        //! The pinned version, or nullptr to follow the current version.
+        SnapshotStore::Version* version;
+
+        //! The table within the version.
+        uint32_t node;
+
+        static EpochDomain::Reader* registerState(lua_State* lua, SnapshotStore* store)
+        {
+            if (lua_rawgetp(lua, LUA_REGISTRYINDEX, store) == LUA_TUSERDATA)
+            {
+                Registration* registration = reinterpret_cast<Registration*>(lua_touserdata(lua, -1));
+                lua_pop(lua, 1);
+
+                return registration->reader;
+            }
+
+            lua_pop(lua, 1);
+
+            Registration* registration = reinterpret_cast<Registration*>(lua_newuserdata(lua, sizeof(Registration)));
+            registration->store = store;
+            registration->reader = store->mEpochs.registerReader();
+
+            if (luaL_newmetatable(lua, READER_METATABLE))
+            {
+                lua_pushcfunction(lua, SnapshotProxy::unregister);
+                lua_setfield(lua, -2, "__gc");
+            }
+            lua_setmetatable(lua, -2);
+
+            lua_rawsetp(lua, LUA_REGISTRYINDEX, store);
+            return registration->reader;
+        }
+
+        static void push(lua_State* lua, SnapshotStore* store, EpochDomain::Reader* reader, SnapshotStore::Version* version, const uint32_t& node)
+        {
+            SnapshotProxy* proxy = reinterpret_cast<SnapshotProxy*>(lua_newuserdata(lua, sizeof(SnapshotProxy)));
+            proxy->store = store;
+            proxy->reader = reader;
+            proxy->version = version;
+            proxy->node = node;
+
+            // Callers hold a reference already, either through the store under an epoch guard or through a pinning proxy
+            if (version)
+                version->references.fetch_add(1, std::memory_order_relaxed);
+
+            if (luaL_newmetatable(lua, METATABLE))
+            {
+                static const luaL_Reg metamethods[] = {
+                    { "__index", SnapshotProxy::index },
+                    { "__newindex", SnapshotProxy::newIndex },
+                    { "__len", SnapshotProxy::length },
+                    { "__pairs", SnapshotProxy::pairs },
+                    { "__gc", SnapshotProxy::collect },
+                    { nullptr, nullptr }
+                };
+
+                luaL_setfuncs(lua, metamethods, 0);
+            }
+            lua_setmetatable(lua, -2);
+        }
+
+        static void pushValue(lua_State* lua, SnapshotProxy* proxy, SnapshotStore::Version* version, const Snapshot::Entry& entry)
+        {
+            const Snapshot& snapshot = *version->snapshot;
+
+            switch (entry.type)
+            {
+                case EASYLUA_INTEGER:
+                {
+                    lua_pushinteger(lua, entry.integer);
+                    break;
+                }
+
+                case EASYLUA_FLOAT:
+                {
+                    lua_pushnumber(lua, entry.number);
+                    break;
+                }
+
+                case EASYLUA_STRING:
+                {
+                    const std::string_view value = snapshot.string(entry);
+                    lua_pushlstring(lua, value.data(), value.size());
+                    break;
+                }
+
+                case EASYLUA_TABLE:
+                {
+                    SnapshotProxy::push(lua, proxy->store, proxy->reader, version, entry.node);
+                    break;
+                }
+            }
+        }
+
+        static int index(lua_State* lua)
+        {
+            SnapshotProxy* proxy = reinterpret_cast<SnapshotProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            if (lua_type(lua, 2) != LUA_TSTRING)
+            {
+                lua_pushnil(lua);
+                return 1;
+            }
+
+            size_t length = 0;
+            const char* key = lua_tolstring(lua, 2, &length);
+
+            EpochDomain::Guard guard(proxy->store->mEpochs, *proxy->reader);
+
+            SnapshotStore::Version* version = proxy->version ? proxy->version : proxy->store->mCurrent.load(std::memory_order_seq_cst);
+            const Snapshot::Entry* entry = version ? version->snapshot->find(proxy->node, std::string_view(key, length)) : nullptr;
+
+            if (entry)
+                SnapshotProxy::pushValue(lua, proxy, version, *entry);
+            else
+                lua_pushnil(lua);
+
+            return 1;
+        }
+
+        static int newIndex(lua_State* lua)
+        {
+            return luaL_error(lua, "Attempted to write to a read-only snapshot!");
+        }
+
+        static int length(lua_State* lua)
+        {
+            SnapshotProxy* proxy = reinterpret_cast<SnapshotProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            EpochDomain::Guard guard(proxy->store->mEpochs, *proxy->reader);
+
+            SnapshotStore::Version* version = proxy->version ? proxy->version : proxy->store->mCurrent.load(std::memory_order_seq_cst);
+            lua_pushinteger(lua, version ? version->snapshot->node(proxy->node).entryCount : 0);
+            return 1;
+        }
+
+        static int next(lua_State* lua)
+        {
+            SnapshotProxy* proxy = reinterpret_cast<SnapshotProxy*>(luaL_checkudata(lua, 1, METATABLE));
+            const Snapshot& snapshot = *proxy->version->snapshot;
+
+            uint32_t slot = 0;
+
+            if (!lua_isnil(lua, 2))
+            {
+                size_t length = 0;
+                const char* key = luaL_checklstring(lua, 2, &length);
+
+                const Snapshot::Entry* current = snapshot.find(proxy->node, std::string_view(key, length));
+                if (!current)
+                    return luaL_error(lua, "Invalid key to 'next' on a snapshot!");
+
+                slot = static_cast<uint32_t>(current - &snapshot.mSlots[snapshot.node(proxy->node).firstSlot]) + 1;
+            }
+
+            const Snapshot::Entry* entry = snapshot.next(proxy->node, slot);
+
+            if (!entry)
+            {
+                lua_pushnil(lua);
+                return 1;
+            }
+
+            const std::string_view key = snapshot.key(*entry);
+            lua_pushlstring(lua, key.data(), key.size());
+            SnapshotProxy::pushValue(lua, proxy, proxy->version, *entry);
+            return 2;
+        }
+
+        static int pairs(lua_State* lua)
+        {
+            SnapshotProxy* proxy = reinterpret_cast<SnapshotProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            if (proxy->version)
+            {
+                lua_pushcfunction(lua, SnapshotProxy::next);
+                lua_pushvalue(lua, 1);
+                lua_pushnil(lua);
+                return 3;
+            }
+
+            // Iterate a pinned view so that the traversal is not torn apart by a publish
+            EpochDomain::Guard guard(proxy->store->mEpochs, *proxy->reader);
+            SnapshotStore::Version* version = proxy->store->mCurrent.load(std::memory_order_seq_cst);
+
+            if (!version)
+            {
+                lua_pushcfunction(lua, SnapshotProxy::emptyNext);
+                lua_pushnil(lua);
+                lua_pushnil(lua);
+                return 3;
+            }
+
+            lua_pushcfunction(lua, SnapshotProxy::next);
+            SnapshotProxy::push(lua, proxy->store, proxy->reader, version, proxy->node);
+            lua_pushnil(lua);
+            return 3;
+        }
+
+        static int emptyNext(lua_State* lua)
+        {
+            lua_pushnil(lua);
+            return 1;
+        }
+
+        static int collect(lua_State* lua)
+        {
+            SnapshotProxy* proxy = reinterpret_cast<SnapshotProxy*>(luaL_checkudata(lua, 1, METATABLE));
+
+            if (proxy->version)
+                SnapshotStore::release(proxy->version);
+            proxy->version = nullptr;
+
+            return 0;
+        }
+
+        static int unregister(lua_State* lua)
+        {
+            Registration* registration = reinterpret_cast<Registration*>(luaL_checkudata(lua, 1, READER_METATABLE));
+
+            registration->store->mEpochs.unregisterReader(registration->reader);
+            return 0;
+        }
+    };
+
+    SnapshotStore::SnapshotStore(void) : mCurrent(nullptr), mNextNumber(1)
+    {
+    }
+
+    SnapshotStore::~SnapshotStore(void)
+    {
+        Version* current = mCurrent.exchange(nullptr);
+
+        if (current)
+            SnapshotStore::release(current);
+    }
+
+    void SnapshotStore::release(Version* version)
+    {
+        // References are only ever added by existing holders, so whoever drops the last one may free it
+        if (version->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete version;
+    }
+
+    void SnapshotStore::publish(std::unique_ptr<Snapshot> snapshot)
+    {
+        std::lock_guard<std::mutex> lock(mPublishMutex);
+
+        Version* version = new Version();
+        version->snapshot = std::move(snapshot);
+        version->number = mNextNumber++;
+        version->references.store(1);
+
+        Version* previous = mCurrent.exchange(version, std::memory_order_seq_cst);
+
+        if (previous)
+        {
+            // Once no reader can still load it from mCurrent, drop the reference held by the store
+            mEpochs.retire([previous]() { SnapshotStore::release(previous); });
+        }
+
+        mEpochs.reclaim();
+    }
+
+    uint64_t SnapshotStore::version(void)
+    {
+        std::lock_guard<std::mutex> lock(mPublishMutex);
+
+        Version* current = mCurrent.load();
+        return current ? current->number : 0;
+    }
+
+    void SnapshotStore::push(lua_State* lua)
+    {
+        EpochDomain::Reader* reader = SnapshotProxy::registerState(lua, this);
+        SnapshotProxy::push(lua, this, reader, nullptr, 0);
+    }
+} // End NameSpace EasyLua
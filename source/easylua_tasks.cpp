@@ -0,0 +1,226 @@
+/**
+ *  @file easylua_tasks.cpp
+ *  @brief Source file implementing the work stealing task pool and parallel Table construction.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <chrono>
+#include <exception>
+
+#include <easylua_tasks.hpp>
+
+namespace EasyLua
+{
+    //! Subtables with fewer entries than this and no subtables of their own are copied without a task.
+    static const size_t PARALLEL_COPY_THRESHOLD = 256;
+
+    //! The pool the calling thread works for, if any.
+    static thread_local const TaskPool* sCurrentPool = nullptr;
+
+    //! The index of the calling thread within sCurrentPool.
+    static thread_local size_t sCurrentWorker = 0;
+
+    TaskPool::TaskPool(const size_t& threads) : mQueued(0), mNextQueue(0), mRunning(true)
+    {
+        size_t count = threads;
+        if (count == 0)
+            count = std::thread::hardware_concurrency();
+        if (count == 0)
+            count = 1;
+
+        for (size_t index = 0; index < count; ++index)
+            mWorkers.emplace_back(new Worker());
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            mThreads.emplace_back([this, index]()
+            {
+                sCurrentPool = this;
+                sCurrentWorker = index;
+
+                while (true)
+                {
+                    if (this->runOne(index))
+                        continue;
+
+                    std::unique_lock<std::mutex> lock(mSleepMutex);
+                    if (!mRunning && mQueued.load() == 0)
+                        break;
+
+                    mWake.wait_for(lock, std::chrono::milliseconds(10), [this]() { return !mRunning || mQueued.load() != 0; });
+                }
+            });
+        }
+    }
+
+    TaskPool::~TaskPool(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mSleepMutex);
+            mRunning = false;
+        }
+
+        mWake.notify_all();
+
+        for (auto it = mThreads.begin(); it != mThreads.end(); it++)
+            (*it).join();
+    }
+
+    size_t TaskPool::current(void) const
+    {
+        return sCurrentPool == this ? sCurrentWorker : mWorkers.size();
+    }
+
+    void TaskPool::run(Group& group, std::function<void()> task)
+    {
+        size_t queue = this->current();
+        if (queue == mWorkers.size())
+            queue = mNextQueue.fetch_add(1, std::memory_order_relaxed) % mWorkers.size();
+
+        group.mPending.fetch_add(1, std::memory_order_relaxed);
+
+        {
+            std::lock_guard<std::mutex> lock(mWorkers[queue]->mutex);
+            mWorkers[queue]->tasks.push_back(Task { std::move(task), &group });
+        }
+
+        mQueued.fetch_add(1, std::memory_order_release);
+        mWake.notify_one();
+    }
+
+    bool TaskPool::runOne(const size_t& self)
+    {
+        Task task;
+        bool found = false;
+
+        // Our own newest task first, as it is the most likely to be hot in cache
+        if (self < mWorkers.size())
+        {
+            Worker& worker = *mWorkers[self];
+            std::lock_guard<std::mutex> lock(worker.mutex);
+
+            if (!worker.tasks.empty())
+            {
+                task = std::move(worker.tasks.back());
+                worker.tasks.pop_back();
+                found = true;
+            }
+        }
+
+        // Then the oldest task of anyone else, which tends to be the largest piece of work
+        for (size_t offset = 1; !found && offset <= mWorkers.size(); ++offset)
+        {
+            Worker& victim = *mWorkers[(self + offset) % mWorkers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+
+            if (!victim.tasks.empty())
+            {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                found = true;
+            }
+        }
+
+        if (!found)
+            return false;
+
+        mQueued.fetch_sub(1, std::memory_order_relaxed);
+
+        try
+        {
+            task.function();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(task.group->mErrorMutex);
+            if (!task.group->mError)
+                task.group->mError = std::current_exception();
+        }
+
+        task.group->mPending.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    void TaskPool::wait(Group& group)
+    {
+        const size_t self = this->current();
+
+        while (group.mPending.load(std::memory_order_acquire) != 0)
+        {
+            if (!this->runOne(self))
+                std::this_thread::yield();
+        }
+
+        if (group.mError)
+        {
+            std::exception_ptr error = group.mError;
+            group.mError = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void Table::copy(Table& other, TaskPool& pool)
+    {
+        std::vector<std::pair<Table*, Table*>> subtables;
+        this->copyFrom(other, &subtables);
+
+        TaskPool::Group group;
+
+        for (auto it = subtables.begin(); it != subtables.end(); it++)
+        {
+            Table* target = (*it).first;
+            Table* source = (*it).second;
+
+            // Small leaves are cheaper to copy than to schedule
+            if (source->mTables.empty() && source->mTypes.size() < PARALLEL_COPY_THRESHOLD)
+                target->copy(*source);
+            else
+                pool.run(group, [target, source, &pool]() { target->copy(*source, pool); });
+        }
+
+        pool.wait(group);
+    }
+
+    void BulkTableBuilder::build(Table& out)
+    {
+        std::vector<Table*> built;
+        built.reserve(mSubtables.size());
+
+        for (size_t index = 0; index < mSubtables.size(); ++index)
+            built.push_back(new Table());
+
+        TaskPool::Group group;
+        for (size_t index = 0; index < mSubtables.size(); ++index)
+        {
+            Table* target = built[index];
+            std::function<void(Table&)>* fill = &mSubtables[index].second;
+
+            mPool.run(group, [target, fill]() { (*fill)(*target); });
+        }
+
+        try
+        {
+            mPool.wait(group);
+        }
+        catch (...)
+        {
+            for (auto it = built.begin(); it != built.end(); it++)
+                delete *it;
+
+            mSubtables.clear();
+            throw;
+        }
+
+        // Attaching happens on this thread alone, so the parent needs no locking
+        for (size_t index = 0; index < mSubtables.size(); ++index)
+            out.setTable(mSubtables[index].first, *built[index]);
+
+        mSubtables.clear();
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,294 @@
+/**
+ *  @file easylua_transfer.cpp
+ *  @brief Source file implementing direct value transfer between Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <easylua_transfer.hpp>
+
+namespace EasyLua
+{
+    //! Strings up to this length are interned by Lua anyway, so deduplicating them gains nothing.
+    static const size_t TRANSFER_SHORT_STRING = 40;
+
+    /**
+     *  @brief The state of one transfer.
+     */
+    class Transfer
+    {
+        // Public Methods
+        public:
+            /**
+             *  @brief Constructor.
+             *  @param source The state to copy from.
+             *  @param destination The state to copy to.
+             */
+            Transfer(lua_State* source, lua_State* destination) : mSource(source), mDestination(destination), mSourceTop(lua_gettop(source)),
+            mDestinationTop(lua_gettop(destination)), mSeen(0), mMade(0), mCount(0)
+            {
+            }
+
+            /**
+             *  @brief Copies the value at the given index.
+             *  @param index The absolute index of the value in the source state.
+             */
+            void run(const int& index)
+            {
+                // Scalars need none of the bookkeeping
+                if (lua_type(mSource, index) != LUA_TTABLE)
+                {
+                    this->reserve(1, 1);
+                    lua_pushvalue(mSource, index);
+                    this->convert();
+                    return;
+                }
+
+                this->reserve(2, 2);
+                lua_newtable(mSource);
+                mSeen = lua_gettop(mSource);
+                lua_newtable(mDestination);
+                mMade = lua_gettop(mDestination);
+
+                lua_pushvalue(mSource, index);
+                this->convert();
+
+                while (!mFrames.empty())
+                {
+                    Frame& frame = mFrames.back();
+
+                    switch (frame.phase)
+                    {
+                        case NEXT:
+                        {
+                            this->reserve(6, 4);
+
+                            if (lua_next(mSource, frame.source) == 0)
+                            {
+                                // The finished table is left on the destination stack for the parent
+                                lua_pop(mSource, 1);
+                                mFrames.pop_back();
+                                break;
+                            }
+
+                            frame.phase = VALUE;
+                            lua_pushvalue(mSource, -2);
+                            this->convert();
+                            break;
+                        }
+
+                        case VALUE:
+                        {
+                            frame.phase = ASSIGN;
+                            lua_pushvalue(mSource, -1);
+                            this->convert();
+                            break;
+                        }
+
+                        case ASSIGN:
+                        {
+                            lua_rawset(mDestination, frame.destination);
+                            lua_pop(mSource, 1);
+                            frame.phase = NEXT;
+                            break;
+                        }
+                    }
+                }
+
+                lua_remove(mDestination, mMade);
+                lua_remove(mSource, mSeen);
+            }
+
+            //! Restores both stacks to how they were before the transfer.
+            void restore(void)
+            {
+                lua_settop(mSource, mSourceTop);
+                lua_settop(mDestination, mDestinationTop);
+            }
+
+        // Private Methods
+        private:
+            /**
+             *  @brief Makes sure both stacks can grow.
+             *  @param source The number of slots needed in the source state.
+             *  @param destination The number of slots needed in the destination state.
+             */
+            void reserve(const int& source, const int& destination)
+            {
+                if (!lua_checkstack(mSource, source) || !lua_checkstack(mDestination, destination))
+                    throw std::runtime_error("Unable to grow the Lua stack during a transfer!");
+            }
+
+            /**
+             *  @brief Converts the value on top of the source stack, consuming it. Scalars and tables seen before
+             *  are pushed to the destination immediately; new tables are created and opened as a frame, consuming
+             *  the source value once the frame finishes.
+             */
+            void convert(void)
+            {
+                switch (lua_type(mSource, -1))
+                {
+                    case LUA_TNIL:
+                        lua_pushnil(mDestination);
+                        break;
+
+                    case LUA_TBOOLEAN:
+                        lua_pushboolean(mDestination, lua_toboolean(mSource, -1));
+                        break;
+
+                    case LUA_TLIGHTUSERDATA:
+                        lua_pushlightuserdata(mDestination, lua_touserdata(mSource, -1));
+                        break;
+
+                    case LUA_TNUMBER:
+                    {
+                        if (lua_isinteger(mSource, -1))
+                            lua_pushinteger(mDestination, lua_tointeger(mSource, -1));
+                        else
+                            lua_pushnumber(mDestination, lua_tonumber(mSource, -1));
+                        break;
+                    }
+
+                    case LUA_TSTRING:
+                    {
+                        size_t length = 0;
+                        const char* string = lua_tolstring(mSource, -1, &length);
+
+                        if (length <= TRANSFER_SHORT_STRING || mMade == 0)
+                        {
+                            lua_pushlstring(mDestination, string, length);
+                            break;
+                        }
+
+                        // Long strings are not interned; the source string stays alive for the whole transfer
+                        auto cached = mStrings.find(string);
+                        if (cached != mStrings.end())
+                        {
+                            lua_rawgeti(mDestination, mMade, (*cached).second);
+                            break;
+                        }
+
+                        lua_pushlstring(mDestination, string, length);
+                        lua_pushvalue(mDestination, -1);
+                        lua_rawseti(mDestination, mMade, ++mCount);
+                        mStrings[string] = mCount;
+                        break;
+                    }
+
+                    case LUA_TTABLE:
+                    {
+                        lua_pushvalue(mSource, -1);
+                        if (lua_rawget(mSource, mSeen) == LUA_TNUMBER)
+                        {
+                            lua_rawgeti(mDestination, mMade, lua_tointeger(mSource, -1));
+                            lua_pop(mSource, 1);
+                            break;
+                        }
+                        lua_pop(mSource, 1);
+
+                        // Count first so the copy is allocated once
+                        const int table = lua_gettop(mSource);
+                        const lua_Unsigned arraySize = lua_rawlen(mSource, table);
+                        lua_Unsigned total = 0;
+
+                        lua_pushnil(mSource);
+                        while (lua_next(mSource, table) != 0)
+                        {
+                            lua_pop(mSource, 1);
+                            ++total;
+                        }
+
+                        const lua_Unsigned recordSize = total > arraySize ? total - arraySize : 0;
+                        lua_createtable(mDestination, static_cast<int>(arraySize), static_cast<int>(recordSize));
+
+                        lua_pushvalue(mSource, table);
+                        lua_pushinteger(mSource, ++mCount);
+                        lua_rawset(mSource, mSeen);
+
+                        lua_pushvalue(mDestination, -1);
+                        lua_rawseti(mDestination, mMade, mCount);
+
+                        lua_pushnil(mSource);
+                        mFrames.push_back(Frame { table, lua_gettop(mDestination), NEXT });
+                        return;
+                    }
+
+                    default:
+                    {
+                        const std::string typeName = lua_typename(mSource, lua_type(mSource, -1));
+                        throw std::runtime_error("Unable to transfer a value of type " + typeName + "!");
+                    }
+                }
+
+                lua_pop(mSource, 1);
+            }
+
+        // Private Members
+        private:
+            //! What a frame does next.
+            enum Phase
+            {
+                //! Fetch the next entry and convert its key.
+                NEXT = 0,
+                //! Convert the value of the current entry.
+                VALUE = 1,
+                //! Store the converted entry.
+                ASSIGN = 2,
+            };
+
+            //! A table being copied.
+            struct Frame
+            {
+                //! The absolute index of the table in the source state. The current key sits above it.
+                int source;
+                //! The absolute index of the copy in the destination state.
+                int destination;
+                //! What happens next.
+                Phase phase;
+            };
+
+            //! The state to copy from.
+            lua_State* mSource;
+            //! The state to copy to.
+            lua_State* mDestination;
+            //! The top of the source stack before the transfer.
+            int mSourceTop;
+            //! The top of the destination stack before the transfer.
+            int mDestinationTop;
+            //! The absolute index of the source table mapping tables seen to their ids.
+            int mSeen;
+            //! The absolute index of the destination table mapping ids to copies.
+            int mMade;
+            //! The last id handed out.
+            lua_Integer mCount;
+            //! Maps long source strings to the ids of their copies.
+            std::unordered_map<const char*, lua_Integer> mStrings;
+            //! The tables being copied, innermost last.
+            std::vector<Frame> mFrames;
+    };
+
+    void transfer(lua_State* source, const int& index, lua_State* destination)
+    {
+        Transfer transfer(source, destination);
+
+        try
+        {
+            transfer.run(lua_absindex(source, index));
+        }
+        catch (...)
+        {
+            transfer.restore();
+            throw;
+        }
+    }
+} // End NameSpace EasyLua
@@ -0,0 +1,165 @@
+/**
+ *  @file test_arrays.cpp
+ *  @brief Source file testing typed array userdata and their kernels.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_arrays.hpp>
+
+#include <gtest/gtest.h>
+
+static const char* KERNEL_SCRIPT =
+    "local values = {}\n"
+    "for i = 1, 37 do values[i] = (i % 7) - 3 end\n"
+    "local f = TypedArray.float64(values)\n"
+    "local g = TypedArray.float32(values)\n"
+    "local n = TypedArray.int32(values)\n"
+    "local results = { f:sum(), f:min(), f:max(), f:dot(f), g:sum(), g:dot(g), n:sum(), n:dot(n), n:min(), n:max() }\n"
+    "f:axpy(2, TypedArray.float64(values)):scale(0.5):clamp(-2, 2):prefixSum()\n"
+    "n:scale(3):clamp(-5, 5):prefixSum()\n"
+    "results[#results + 1] = f[#f]\n"
+    "results[#results + 1] = n[#n]\n"
+    "results[#results + 1] = n[17]\n"
+    "return results\n";
+
+TEST(Arrays, Construction)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+    EasyLua::TypedArray::open(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "a = TypedArray.float32(5) a[2] = 1.5 b = TypedArray.int32({ 1, 2, 3 })"));
+
+    lua_getglobal(lua, "a");
+    EasyLua::TypedArray* array = nullptr;
+    EXPECT_EQ(-1, EasyLua::Utilities::readStack<true>(lua, &array));
+    ASSERT_NE(nullptr, array);
+    EXPECT_EQ(EasyLua::TypedArray::FLOAT32, array->type());
+    EXPECT_EQ(5, array->length());
+    EXPECT_TRUE(array->isOwned());
+    EXPECT_EQ(0.0f, array->data<float>()[0]);
+    EXPECT_EQ(1.5f, array->data<float>()[1]);
+    EXPECT_THROW(array->data<double>(), std::runtime_error);
+    EXPECT_THROW(array->detach(), std::runtime_error);
+    lua_pop(lua, 1);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return #b, b[1], b[3], b[0], b[4], b:type(), tostring(b)"));
+    EXPECT_EQ(3, lua_tointeger(lua, 1));
+    EXPECT_TRUE(lua_isinteger(lua, 2));
+    EXPECT_EQ(1, lua_tointeger(lua, 2));
+    EXPECT_EQ(3, lua_tointeger(lua, 3));
+    EXPECT_TRUE(lua_isnil(lua, 4));
+    EXPECT_TRUE(lua_isnil(lua, 5));
+    EXPECT_STREQ("int32", lua_tostring(lua, 6));
+    EXPECT_STREQ("TypedArray(int32, 3)", lua_tostring(lua, 7));
+    lua_settop(lua, 0);
+
+    // Invalid construction and writes raise Lua errors
+    EXPECT_NE(0, luaL_dostring(lua, "TypedArray.float64(-1)"));
+    lua_pop(lua, 1);
+    EXPECT_NE(0, luaL_dostring(lua, "TypedArray.int32({ 1, 'x' })"));
+    lua_pop(lua, 1);
+    EXPECT_NE(0, luaL_dostring(lua, "b[4] = 1"));
+    lua_pop(lua, 1);
+    EXPECT_NE(0, luaL_dostring(lua, "b[1] = 1.5"));
+    lua_pop(lua, 1);
+    EXPECT_NE(0, luaL_dostring(lua, "a:dot(b)"));
+    lua_pop(lua, 1);
+
+    lua_pushinteger(lua, 1);
+    EXPECT_EQ(nullptr, EasyLua::TypedArray::get(lua, -1));
+    lua_pop(lua, 1);
+
+    lua_close(lua);
+}
+
+TEST(Arrays, Borrowed)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+    EasyLua::TypedArray::open(lua);
+
+    double* values = new double[10];
+    for (int index = 0; index < 10; ++index)
+        values[index] = index;
+
+    EasyLua::TypedArray* array = EasyLua::TypedArray::borrow(lua, values, 10);
+    EXPECT_FALSE(array->isOwned());
+    lua_setglobal(lua, "borrowed");
+
+    // Scripts operate on the C++ memory directly
+    EXPECT_EQ(0, luaL_dostring(lua, "borrowed:scale(2) borrowed[1] = 7 return borrowed:sum()"));
+    EXPECT_EQ(97.0, lua_tonumber(lua, -1));
+    lua_pop(lua, 1);
+    EXPECT_EQ(7.0, values[0]);
+    EXPECT_EQ(18.0, values[9]);
+
+    // Detached arrays are empty rather than dangling
+    array->detach();
+    delete[] values;
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return #borrowed, borrowed:sum(), borrowed:min(), borrowed[1]"));
+    EXPECT_EQ(0, lua_tointeger(lua, 1));
+    EXPECT_EQ(0.0, lua_tonumber(lua, 2));
+    EXPECT_TRUE(lua_isnil(lua, 3));
+    EXPECT_TRUE(lua_isnil(lua, 4));
+
+    lua_close(lua);
+}
+
+TEST(Arrays, Kernels)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+    EasyLua::TypedArray::open(lua);
+
+    // Every instruction set must produce the same results
+    const EasyLua::TypedArray::KernelLevel best = EasyLua::TypedArray::useKernels(EasyLua::TypedArray::KERNELS_AVX2);
+    std::vector<double> expected;
+
+    for (int level = EasyLua::TypedArray::KERNELS_SCALAR; level <= best; ++level)
+    {
+        EXPECT_EQ(level, EasyLua::TypedArray::useKernels(static_cast<EasyLua::TypedArray::KernelLevel>(level)));
+
+        ASSERT_EQ(0, luaL_dostring(lua, KERNEL_SCRIPT));
+
+        std::vector<double> results;
+        EXPECT_EQ(-1, EasyLua::Utilities::readStack<true>(lua, &results));
+        lua_pop(lua, 1);
+
+        if (expected.empty())
+        {
+            expected = results;
+
+            // (i % 7) - 3 cycles through -2..3, -3 summing to zero, leaving -2 and -1 for the last two values
+            EXPECT_EQ(-3.0, results[0]);
+            EXPECT_EQ(-3.0, results[1]);
+            EXPECT_EQ(3.0, results[2]);
+            EXPECT_EQ(-3.0, results[6]);
+            EXPECT_EQ(-3.0, results[8]);
+        }
+        else
+            EXPECT_EQ(expected, results);
+    }
+
+    EXPECT_EQ(best, EasyLua::TypedArray::kernels());
+
+    // int32 sums are accumulated into 64 bits
+    EXPECT_EQ(0, luaL_dostring(lua, "local a = TypedArray.int32(40) for i = 1, #a do a[i] = 2000000000 end return a:sum()"));
+    EXPECT_TRUE(lua_isinteger(lua, 1));
+    EXPECT_EQ(80000000000LL, lua_tointeger(lua, 1));
+
+    lua_close(lua);
+}
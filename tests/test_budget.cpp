@@ -0,0 +1,84 @@
+/**
+ *  @file test_budget.cpp
+ *  @brief Source file testing calls bounded by an instruction or time budget.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_budget.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Budget, Abort)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "function spin() while true do end end function add(a, b) return a + b end"));
+
+    EasyLua::Budget budget(100000);
+
+    // Calls within budget behave as usual
+    std::pair<int, size_t> result = EasyLua::pcall(lua, budget, "add", 1, 2);
+    EXPECT_EQ(LUA_OK, result.first);
+    EXPECT_EQ(1, result.second);
+    EXPECT_EQ(3, lua_tointeger(lua, -1));
+    EXPECT_FALSE(budget.exhausted());
+    lua_settop(lua, 0);
+
+    result = EasyLua::pcall(lua, budget, "spin");
+    EXPECT_EQ(EasyLua::EASYLUA_ERRBUDGET, result.first);
+    EXPECT_TRUE(budget.exhausted());
+    EXPECT_GE(budget.used(), 100000);
+    lua_settop(lua, 0);
+
+    EasyLua::Budget timeBudget(0, std::chrono::milliseconds(20));
+    EXPECT_THROW(EasyLua::call(lua, timeBudget, "spin"), EasyLua::BudgetExceeded);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    // The hook is gone afterwards
+    EXPECT_EQ(nullptr, lua_gethook(lua));
+
+    lua_close(lua);
+}
+
+TEST(Budget, Yield)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "function count() local n = 0 for i = 1, 100000 do n = n + 1 end return n end"));
+
+    lua_State* thread = lua_newthread(lua);
+    lua_getglobal(thread, "count");
+
+    EasyLua::Budget budget(10000, std::chrono::nanoseconds::zero(), EasyLua::Budget::YIELD);
+
+    size_t slices = 0;
+    std::pair<int, int> result = std::make_pair(LUA_YIELD, 0);
+
+    while (result.first == LUA_YIELD)
+    {
+        result = EasyLua::resume(thread, lua, budget, 0);
+        ++slices;
+
+        if (result.first == LUA_YIELD)
+            EXPECT_TRUE(budget.exhausted());
+    }
+
+    EXPECT_EQ(LUA_OK, result.first);
+    EXPECT_GT(slices, 1);
+    EXPECT_EQ(1, result.second);
+    EXPECT_EQ(100000, lua_tointeger(thread, -1));
+
+    lua_close(lua);
+}
@@ -0,0 +1,55 @@
+/**
+ *  @file test_columns.cpp
+ *  @brief Source file testing the columnar decoding of record arrays.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Columns, Basic)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return { { id = 1, x = 0.5, name = 'a' }, { id = 2, x = 1.5 }, { id = 3, x = 2.5, name = 'c' } }"));
+    const int top = lua_gettop(lua);
+
+    EasyLua::ColumnSchema<int, double, std::string> schema("id", "x", "name");
+    auto columns = EasyLua::readColumns(lua, -1, schema);
+
+    const std::vector<int>& ids = std::get<0>(columns);
+    const std::vector<double>& xs = std::get<1>(columns);
+    const std::vector<std::string>& names = std::get<2>(columns);
+
+    ASSERT_EQ(3, ids.size());
+    ASSERT_EQ(3, xs.size());
+    ASSERT_EQ(3, names.size());
+
+    EXPECT_EQ(2, ids[1]);
+    EXPECT_EQ(2.5, xs[2]);
+    EXPECT_EQ("a", names[0]);
+    EXPECT_EQ("", names[1]);
+    EXPECT_EQ(top, lua_gettop(lua));
+
+    // Type mismatches throw and leave the stack intact
+    EasyLua::ColumnSchema<int> badSchema("name");
+    EXPECT_THROW(EasyLua::readColumns(lua, -1, badSchema), std::runtime_error);
+    EXPECT_EQ(top, lua_gettop(lua));
+
+    // So do numbers that are not integers when an integral column is expected
+    EasyLua::ColumnSchema<int> fractionalSchema("x");
+    EXPECT_THROW(EasyLua::readColumns(lua, -1, fractionalSchema), std::runtime_error);
+    EXPECT_EQ(top, lua_gettop(lua));
+
+    lua_close(lua);
+}
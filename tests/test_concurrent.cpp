@@ -0,0 +1,154 @@
+/**
+ *  @file test_concurrent.cpp
+ *  @brief Source file testing the Table variant for concurrent readers and writers.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <easylua_concurrent.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Concurrent, ReadersAndWriters)
+{
+    EasyLua::ConcurrentTable table(8);
+    std::atomic<bool> writing(true);
+    std::atomic<size_t> mismatches(0);
+
+    std::vector<std::thread> writers;
+    for (int writer = 0; writer < 4; ++writer)
+    {
+        writers.emplace_back([&table, writer]()
+        {
+            for (int index = 0; index < 2000; ++index)
+                table.set("W" + std::to_string(writer) + "_" + std::to_string(index % 50), index);
+        });
+    }
+
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader)
+    {
+        readers.emplace_back([&table, &writing, &mismatches]()
+        {
+            EasyLua::ConcurrentTable::Reader slot(table);
+
+            while (writing.load())
+            {
+                int value = 0;
+                try
+                {
+                    table.get(slot, "W0_7", value);
+                    if (value % 50 != 7)
+                        ++mismatches;
+                }
+                catch (std::out_of_range&) { }
+            }
+        });
+    }
+
+    for (auto it = writers.begin(); it != writers.end(); it++)
+        (*it).join();
+
+    writing.store(false);
+
+    for (auto it = readers.begin(); it != readers.end(); it++)
+        (*it).join();
+
+    EXPECT_EQ(0, mismatches.load());
+
+    EasyLua::ConcurrentTable::Reader slot(table);
+    EXPECT_EQ(200, table.size(slot));
+
+    int value = 0;
+    table.get(slot, "W3_49", value);
+    EXPECT_EQ(1999, value);
+
+    EasyLua::Table sub;
+    sub.set("Name", "Sub");
+    table.set("Sub", sub);
+    table.remove("W0_0");
+
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    table.push(slot, lua);
+    lua_setglobal(lua, "Shared");
+
+    EXPECT_EQ(0, luaL_dostring(lua, "local count = 0 for _ in pairs(Shared) do count = count + 1 end return count, Shared.W1_10, Shared.Sub.Name, Shared.W0_0"));
+    EXPECT_EQ(200, lua_tointeger(lua, 1));
+    EXPECT_EQ(1960, lua_tointeger(lua, 2));
+    EXPECT_STREQ("Sub", lua_tostring(lua, 3));
+    EXPECT_TRUE(lua_isnil(lua, 4));
+
+    lua_close(lua);
+}
+
+TEST(Concurrent, GrowAndCopy)
+{
+    EasyLua::ConcurrentTable table(2);
+    std::atomic<bool> writing(true);
+    std::atomic<size_t> torn(0);
+
+    std::thread writer([&table]()
+    {
+        for (int index = 0; index < 1000; ++index)
+            table.set("K" + std::to_string(index), index);
+
+        for (int index = 0; index < 1000; index += 2)
+            table.remove("K" + std::to_string(index));
+    });
+
+    std::thread reader([&table, &writing, &torn]()
+    {
+        EasyLua::ConcurrentTable::Reader slot(table);
+
+        while (writing.load())
+        {
+            EasyLua::Table copy;
+            table.copy(slot, copy);
+
+            int value = 0;
+            for (int index = 0; index < 1000; index += 97)
+            {
+                try
+                {
+                    copy.get("K" + std::to_string(index), value);
+                    if (value != index)
+                        ++torn;
+                }
+                catch (std::out_of_range&) { }
+            }
+        }
+    });
+
+    writer.join();
+    writing.store(false);
+    reader.join();
+
+    EXPECT_EQ(0, torn.load());
+
+    EasyLua::ConcurrentTable::Reader slot(table);
+    EXPECT_EQ(500, table.size(slot));
+    EXPECT_FALSE(table.contains(slot, "K0"));
+    EXPECT_TRUE(table.contains(slot, "K999"));
+
+    EasyLua::Table copy;
+    table.copy(slot, copy);
+    EXPECT_EQ(500, copy.size());
+
+    int value = 0;
+    copy.get("K501", value);
+    EXPECT_EQ(501, value);
+}
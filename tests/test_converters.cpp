@@ -0,0 +1,246 @@
+/**
+ *  @file test_converters.cpp
+ *  @brief Source file testing the type converters used for every push and read.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+    enum class Color
+    {
+        Red = 1,
+        Green = 2,
+    };
+
+    struct Point
+    {
+        int x;
+        int y;
+    };
+}
+
+namespace EasyLua
+{
+    // A custom converter exchanging points as { x = ..., y = ... }
+    template <>
+    struct Converter<Point>
+    {
+        static constexpr const char* name = "point";
+
+        static void push(lua_State* lua, const Point& value)
+        {
+            EasyLua::Utilities::pushTable(lua, "x", value.x, "y", value.y);
+        }
+
+        static bool check(lua_State* lua, const int& index) { return lua_type(lua, index) == LUA_TTABLE; }
+
+        static Point read(lua_State* lua, const int& index)
+        {
+            Point result;
+            lua_getfield(lua, index, "x");
+            result.x = static_cast<int>(lua_tointeger(lua, -1));
+            lua_getfield(lua, index < 0 ? index - 1 : index, "y");
+            result.y = static_cast<int>(lua_tointeger(lua, -1));
+            lua_pop(lua, 2);
+            return result;
+        }
+    };
+}
+
+TEST(Converters, Scalars)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    const lua_Integer large = 1LL << 40;
+    EasyLua::Utilities::pushParameters(lua, 42, large, 2.5, true, "text", std::string("string"), std::string_view("view"), Color::Green);
+    ASSERT_EQ(8, lua_gettop(lua));
+
+    int integer = 0;
+    lua_Integer longInteger = 0;
+    double number = 0;
+    bool boolean = false;
+    const char* text = nullptr;
+    std::string string;
+    std::string_view view;
+    Color color = Color::Red;
+
+    EXPECT_EQ(-1, EasyLua::Utilities::readStack<true>(lua, &integer, &longInteger, &number, &boolean, &text, &string, &view, &color));
+
+    // Integers used to be left unwritten
+    EXPECT_EQ(42, integer);
+    EXPECT_EQ(large, longInteger);
+    EXPECT_EQ(2.5, number);
+    EXPECT_TRUE(boolean);
+    EXPECT_STREQ("text", text);
+    EXPECT_EQ("string", string);
+    EXPECT_EQ("view", view);
+    EXPECT_EQ(Color::Green, color);
+
+    lua_close(lua);
+}
+
+TEST(Converters, Containers)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    const std::vector<int> vector = { 1, 2, 3 };
+    const std::array<float, 2> array = {{ 0.5f, 1.5f }};
+    const std::map<std::string, int> map = { { "one", 1 }, { "two", 2 } };
+    const std::tuple<int, std::string, bool> tuple(7, "seven", true);
+    const std::pair<std::string, double> pair("pi", 3.25);
+    const std::optional<int> optional;
+
+    EasyLua::Utilities::pushParameters(lua, vector, array, map, tuple, pair, optional);
+    ASSERT_EQ(6, lua_gettop(lua));
+
+    // Containers are plain Lua tables
+    EXPECT_EQ(3, lua_rawlen(lua, 1));
+    lua_rawgeti(lua, 1, 3);
+    EXPECT_EQ(3, lua_tointeger(lua, -1));
+    lua_pop(lua, 1);
+
+    std::vector<int> vectorOut;
+    std::array<float, 2> arrayOut = {{ 0, 0 }};
+    std::map<std::string, int> mapOut;
+    std::tuple<int, std::string, bool> tupleOut;
+    std::pair<std::string, double> pairOut;
+    std::optional<int> optionalOut = 1;
+
+    EXPECT_EQ(-1, EasyLua::Utilities::readStack<true>(lua, &vectorOut, &arrayOut, &mapOut, &tupleOut, &pairOut, &optionalOut));
+    EXPECT_EQ(vector, vectorOut);
+    EXPECT_EQ(array, arrayOut);
+    EXPECT_EQ(map, mapOut);
+    EXPECT_EQ(tuple, tupleOut);
+    EXPECT_EQ(pair, pairOut);
+
+    // Empty optionals travel as nil
+    EXPECT_TRUE(lua_isnil(lua, 6));
+    EXPECT_FALSE(optionalOut.has_value());
+
+    lua_close(lua);
+}
+
+TEST(Converters, Mismatches)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return 1, { 1, 2, 'three' }"));
+    ASSERT_EQ(2, lua_gettop(lua));
+
+    int integer = 0;
+    std::string string;
+    std::vector<int> vector;
+
+    // Without exceptions the index of the first mismatch is returned
+    EXPECT_EQ(1, EasyLua::Utilities::readStack<false>(lua, &string));
+    EXPECT_THROW(EasyLua::Utilities::readStack<true>(lua, &string), std::runtime_error);
+
+    // Element mismatches always throw and leave the stack intact
+    EXPECT_THROW(EasyLua::Utilities::readStack<false>(lua, &integer, &vector), std::runtime_error);
+    EXPECT_EQ(2, lua_gettop(lua));
+
+    lua_close(lua);
+}
+
+TEST(Converters, IntegerRanges)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return 3.0, 2.5, 0/0, math.huge, 300, -1, 2"));
+    ASSERT_EQ(7, lua_gettop(lua));
+
+    // Floats holding an exact integer convert
+    EXPECT_TRUE(EasyLua::Converter<int>::check(lua, 1));
+    EXPECT_EQ(3, EasyLua::Converter<int>::read(lua, 1));
+
+    // Fractions, NaN and infinities never do
+    EXPECT_FALSE(EasyLua::Converter<int>::check(lua, 2));
+    EXPECT_FALSE(EasyLua::Converter<int>::check(lua, 3));
+    EXPECT_FALSE(EasyLua::Converter<int>::check(lua, 4));
+    EXPECT_THROW(EasyLua::Converter<int>::read(lua, 3), std::runtime_error);
+
+    // Narrowing and sign changes are refused rather than wrapped
+    EXPECT_FALSE(EasyLua::Converter<unsigned char>::check(lua, 5));
+    EXPECT_FALSE(EasyLua::Converter<unsigned int>::check(lua, 6));
+    EXPECT_THROW(EasyLua::Converter<unsigned char>::read(lua, 5), std::runtime_error);
+    EXPECT_TRUE(EasyLua::Converter<short>::check(lua, 6));
+
+    EXPECT_TRUE(EasyLua::Converter<Color>::check(lua, 7));
+    EXPECT_EQ(Color::Green, EasyLua::Converter<Color>::read(lua, 7));
+    EXPECT_FALSE(EasyLua::Converter<Color>::check(lua, 2));
+
+    lua_close(lua);
+}
+
+TEST(Converters, Arrays)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    // Every value type may appear in an array
+    EasyLua::Utilities::pushArray(lua, 1, 2.5f, 3.5, false, "five");
+    ASSERT_EQ(1, lua_gettop(lua));
+    EXPECT_EQ(5, lua_rawlen(lua, 1));
+
+    lua_rawgeti(lua, 1, 2);
+    EXPECT_EQ(2.5, lua_tonumber(lua, -1));
+    lua_rawgeti(lua, 1, 5);
+    EXPECT_STREQ("five", lua_tostring(lua, -1));
+
+    lua_close(lua);
+}
+
+TEST(Converters, Custom)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "function easyLuaConverterTest(points) return { x = points[1].x + points[2].x, y = points[1].y + points[2].y } end"));
+
+    // Custom converters compose with the built in containers
+    const std::vector<Point> points = { { 1, 2 }, { 3, 4 } };
+    EasyLua::call(lua, "easyLuaConverterTest", points);
+    ASSERT_EQ(1, lua_gettop(lua));
+
+    Point sum = { 0, 0 };
+    EXPECT_EQ(-1, EasyLua::Utilities::readStack<true>(lua, &sum));
+    EXPECT_EQ(4, sum.x);
+    EXPECT_EQ(6, sum.y);
+
+    // Keys and values in table descriptions resolve through the same converters
+    EasyLua::Utilities::pushTable(lua, "point", Point{ 5, 6 }, "values", std::vector<int>{ 1, 2 });
+    lua_getfield(lua, -1, "point");
+
+    Point point = { 0, 0 };
+    EasyLua::Resolvers::StackReadResolver<true, Point>::resolve(lua, -1, &point);
+    EXPECT_EQ(5, point.x);
+    EXPECT_EQ(6, point.y);
+
+    lua_close(lua);
+}
@@ -0,0 +1,70 @@
+/**
+ *  @file test_events.cpp
+ *  @brief Source file testing batched event dispatch to Lua handlers.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <string>
+
+#include <easylua_events.hpp>
+
+#include <gtest/gtest.h>
+
+struct Input
+{
+    int key;
+    bool pressed;
+    double time;
+    std::string device;
+};
+
+TEST(Events, Batching)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "Batches = 0 Keys = 0 Last = nil "
+                                    "function onInput(events) Batches = Batches + 1 for _, e in ipairs(events) do Keys = Keys + e.key Last = e end end"));
+
+    {
+        EasyLua::EventBus bus(lua, "onInput", 4, std::chrono::hours(1), EasyLua::field("key", &Input::key), EasyLua::field("pressed", &Input::pressed),
+        EasyLua::field("time", &Input::time), EasyLua::field("device", &Input::device));
+
+        for (int key = 1; key <= 10; ++key)
+            bus.publish(Input { key, key % 2 == 0, key * 0.5, "keyboard" });
+
+        // Two full batches went out, the rest waits
+        EXPECT_EQ(2, bus.pending());
+        EXPECT_EQ(2, bus.flush());
+        EXPECT_EQ(0, bus.flush());
+    }
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return Batches, Keys, Last.key, Last.pressed, Last.time, Last.device"));
+    EXPECT_EQ(3, lua_tointeger(lua, 1));
+    EXPECT_EQ(55, lua_tointeger(lua, 2));
+    EXPECT_EQ(10, lua_tointeger(lua, 3));
+    EXPECT_TRUE(lua_toboolean(lua, 4));
+    EXPECT_EQ(5.0, lua_tonumber(lua, 5));
+    EXPECT_STREQ("keyboard", lua_tostring(lua, 6));
+    lua_settop(lua, 0);
+
+    {
+        // A zero delay flushes on every publish
+        EasyLua::EventBus bus(lua, "onInput", 100, std::chrono::nanoseconds::zero(), EasyLua::field("key", &Input::key));
+        EXPECT_TRUE(bus.publish(Input { 1, false, 0.0, "" }));
+        EXPECT_EQ(0, bus.pending());
+    }
+
+    EXPECT_THROW(EasyLua::EventBus(lua, "missing", 1, std::chrono::nanoseconds::zero(), EasyLua::field("key", &Input::key)), std::runtime_error);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    lua_close(lua);
+}
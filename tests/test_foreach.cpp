@@ -0,0 +1,95 @@
+/**
+ *  @file test_foreach.cpp
+ *  @brief Source file testing the visitor based table iteration.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <string>
+
+#include <easylua.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(ForEach, Basic)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return { 10, 20, 30, Name = 'Test', Ratio = 0.5, Flag = true, Sub = { 1, 2 } }"));
+    const int top = lua_gettop(lua);
+
+    lua_Integer arraySum = 0;
+    std::string name;
+    double ratio = 0;
+    size_t subLength = 0;
+    lua_Integer subSum = 0;
+
+    struct Visitor
+    {
+        lua_Integer& arraySum;
+        std::string& name;
+        double& ratio;
+        size_t& subLength;
+        lua_Integer& subSum;
+
+        void operator()(lua_Integer key, lua_Integer value) { arraySum += value; }
+        void operator()(std::string_view key, std::string_view value) { name = std::string(value); }
+        void operator()(std::string_view key, lua_Number value) { ratio = value; }
+        void operator()(std::string_view key, const EasyLua::TableCursor& value)
+        {
+            subLength = value.length();
+            value.forEach([this](lua_Integer, lua_Integer element) { subSum += element; });
+        }
+    };
+
+    EXPECT_TRUE(EasyLua::forEach(lua, -1, Visitor{arraySum, name, ratio, subLength, subSum}));
+
+    EXPECT_EQ(60, arraySum);
+    EXPECT_EQ("Test", name);
+    EXPECT_EQ(0.5, ratio);
+    EXPECT_EQ(2, subLength);
+    EXPECT_EQ(3, subSum);
+
+    // Returning false stops the walk and leaves the stack as it was
+    size_t visited = 0;
+    EXPECT_FALSE(EasyLua::forEach(lua, -1, [&visited](auto, auto) { ++visited; return false; }));
+    EXPECT_EQ(1, visited);
+    EXPECT_EQ(top, lua_gettop(lua));
+
+    lua_close(lua);
+}
+
+TEST(ForEach, ExactTypes)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return { Flag = true, Ratio = 0.5, [true] = 7 }"));
+
+    // Neither the bool value nor the bool key may be converted to a number
+    size_t numbers = 0;
+    lua_Number ratio = 0;
+    EXPECT_TRUE(EasyLua::forEach(lua, -1, [&numbers, &ratio](std::string_view key, lua_Number value) { ++numbers; ratio = value; }));
+    EXPECT_EQ(1, numbers);
+    EXPECT_EQ(0.5, ratio);
+
+    size_t integerKeys = 0;
+    EXPECT_TRUE(EasyLua::forEach(lua, -1, [&integerKeys](lua_Integer key, lua_Integer value) { ++integerKeys; }));
+    EXPECT_EQ(0, integerKeys);
+
+    size_t flags = 0;
+    EXPECT_TRUE(EasyLua::forEach(lua, -1, [&flags](std::string_view key, bool value) { ++flags; }));
+    EXPECT_EQ(1, flags);
+
+    lua_close(lua);
+}
@@ -0,0 +1,68 @@
+/**
+ *  @file test_gc.cpp
+ *  @brief Source file testing explicit garbage collection scheduling.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_gc.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(GC, SuspendAndIdle)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EasyLua::GCController controller(lua);
+    controller.incremental(200, 100);
+
+    {
+        EasyLua::GCController::Suspension outer(controller);
+
+        {
+            EasyLua::GCController::Suspension inner(controller);
+            EXPECT_EQ(0, lua_gc(lua, LUA_GCISRUNNING, 0));
+        }
+
+        // Still suspended until the outermost suspension ends
+        EXPECT_TRUE(controller.suspended());
+        EXPECT_EQ(0, lua_gc(lua, LUA_GCISRUNNING, 0));
+
+        // Garbage piles up rather than being collected during the batch
+        const size_t before = controller.memory();
+        EXPECT_EQ(0, luaL_dostring(lua, "for i = 1, 10000 do local t = { i, tostring(i) } end"));
+        EXPECT_GT(controller.memory(), before);
+
+        // Idle windows catch up in bounded steps, even while suspended
+        const size_t piled = controller.memory();
+        while (!controller.idle(std::chrono::microseconds(200)));
+        EXPECT_LT(controller.memory(), piled);
+    }
+
+    EXPECT_FALSE(controller.suspended());
+    EXPECT_NE(0, lua_gc(lua, LUA_GCISRUNNING, 0));
+
+    controller.collect();
+
+    const EasyLua::GCController::Statistics& statistics = controller.statistics();
+    EXPECT_GE(statistics.cycles, 2);
+    EXPECT_GE(statistics.steps, statistics.cycles);
+    EXPECT_GT(statistics.time.count(), 0);
+    EXPECT_LE(statistics.longest, statistics.time);
+
+#if LUA_VERSION_NUM >= 504
+    controller.generational();
+    EXPECT_EQ(0, luaL_dostring(lua, "for i = 1, 1000 do local t = {} end"));
+    controller.incremental();
+#endif
+
+    lua_close(lua);
+}
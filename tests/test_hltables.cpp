@@ -12,6 +12,7 @@
  */
 
 #include <iostream>
+#include <map>
 
 #include <easylua.hpp>
 
@@ -84,3 +85,322 @@ TEST(HLTables, Basic)
 
     lua_close(lua);
 }
+
+TEST(HLTables, Sync)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EasyLua::Table table;
+    EasyLua::Table* subTable = new EasyLua::Table();
+
+    table.set("One", 1);
+    table.set("Two", 2.0f);
+    subTable->set("Three", 3);
+    table.setTable("Sub", *subTable);
+
+    // The first sync builds the whole table
+    EXPECT_TRUE(table.isDirty());
+    table.sync(lua);
+    lua_setglobal(lua, "state");
+    EXPECT_FALSE(table.isDirty());
+
+    EXPECT_EQ(0, luaL_dostring(lua, "sub = state.Sub"));
+
+    // Later syncs write changes into the very same table
+    table.set("One", 10);
+    table.remove("Two");
+    subTable->set("Four", 4);
+    EXPECT_TRUE(table.isDirty());
+
+    table.sync(lua);
+    lua_getglobal(lua, "state");
+    EXPECT_TRUE(lua_rawequal(lua, -1, -2));
+    lua_pop(lua, 2);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return state.One == 10 and state.Two == nil and state.Sub == sub and sub.Four == 4"));
+    EXPECT_TRUE(lua_toboolean(lua, -1));
+    lua_pop(lua, 1);
+
+    table.release(lua);
+    lua_close(lua);
+}
+
+TEST(HLTables, SyncStates)
+{
+    lua_State* first = luaL_newstate();
+    luaL_openlibs(first);
+    lua_State* second = luaL_newstate();
+    luaL_openlibs(second);
+
+    // Keep the synced table only weakly, so it can be collected once the registry lets go of it
+    EXPECT_EQ(0, luaL_dostring(first, "weak = setmetatable({}, { __mode = 'v' })"));
+
+    {
+        EasyLua::Table table;
+        table.set("One", 1);
+
+        table.sync(first);
+        lua_setglobal(first, "synced");
+        EXPECT_EQ(0, luaL_dostring(first, "weak[1] = synced synced = nil collectgarbage()"));
+
+        // Syncing to another state drops the reference held in the first one
+        table.sync(second);
+        lua_pop(second, 1);
+        EXPECT_EQ(0, luaL_dostring(first, "collectgarbage() return weak[1] == nil"));
+        EXPECT_TRUE(lua_toboolean(first, -1));
+        lua_pop(first, 1);
+
+        table.sync(second);
+        lua_setglobal(second, "synced");
+        EXPECT_EQ(0, luaL_dostring(second, "weak = setmetatable({ synced }, { __mode = 'v' }) synced = nil"));
+    }
+
+    // Destroying the table drops its reference as well
+    EXPECT_EQ(0, luaL_dostring(second, "collectgarbage() return weak[1] == nil"));
+    EXPECT_TRUE(lua_toboolean(second, -1));
+
+    lua_close(first);
+    lua_close(second);
+}
+
+TEST(HLTables, SyncClosedState)
+{
+    EasyLua::Table table;
+    EasyLua::Table* subTable = new EasyLua::Table();
+    subTable->set("Two", 2);
+    table.set("One", 1);
+    table.setTable("Sub", *subTable);
+
+    // Closing the state without releasing first must leave the table safe to sync again and destroy
+    lua_State* lua = luaL_newstate();
+    table.sync(lua);
+    lua_pop(lua, 1);
+    EXPECT_FALSE(table.isDirty());
+    lua_close(lua);
+    EXPECT_TRUE(table.isDirty());
+
+    lua = luaL_newstate();
+    table.sync(lua);
+    EXPECT_EQ(LUA_TTABLE, lua_getfield(lua, -1, "Sub"));
+    EXPECT_EQ(LUA_TNUMBER, lua_getfield(lua, -1, "Two"));
+    lua_settop(lua, 0);
+    lua_close(lua);
+}
+
+TEST(HLTables, PushJob)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EasyLua::Table table;
+    EasyLua::Table* subTable = new EasyLua::Table();
+
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        table.set("Key" + std::to_string(iteration), iteration);
+        subTable->set("Key" + std::to_string(iteration), "Value");
+    }
+    table.setTable("Sub", *subTable);
+
+    const int top = lua_gettop(lua);
+
+    // Each step is bounded, so this takes several steps
+    {
+        EasyLua::TablePushJob job(lua, table);
+        size_t steps = 0;
+
+        while (!job.step(static_cast<size_t>(16)))
+        {
+            EXPECT_EQ(top, lua_gettop(lua));
+            ++steps;
+        }
+
+        EXPECT_GT(steps, 10);
+        EXPECT_EQ(201, job.converted());
+
+        job.push();
+        lua_setglobal(lua, "staged");
+    }
+
+    EXPECT_EQ(0, luaL_dostring(lua, "local count = 0 for _ in pairs(staged.Sub) do count = count + 1 end return staged.Key42 == 42 and count == 100"));
+    EXPECT_TRUE(lua_toboolean(lua, -1));
+    lua_pop(lua, 1);
+
+    lua_close(lua);
+}
+
+TEST(HLTables, Proxy)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EasyLua::Table table;
+    EasyLua::Table* subTable = new EasyLua::Table();
+
+    table.set("One", 1);
+    table.set("Name", "Config");
+    subTable->set("Two", 2.0f);
+    table.setTable("Sub", *subTable);
+
+    for (int cache = 0; cache < 2; ++cache)
+    {
+        table.pushProxy(lua, cache != 0);
+        lua_setglobal(lua, "config");
+
+        EXPECT_EQ(0, luaL_dostring(lua, "local count = 0 for _ in pairs(config) do count = count + 1 end "
+                                        "return config.One == 1 and config.Name == 'Config' and config.Sub.Two == 2 and "
+                                        "config.Missing == nil and #config == 3 and count == 3"));
+        EXPECT_TRUE(lua_toboolean(lua, -1));
+        lua_pop(lua, 1);
+
+        // Proxies are read-only
+        EXPECT_NE(0, luaL_dostring(lua, "config.One = 2"));
+        lua_pop(lua, 1);
+    }
+
+    lua_close(lua);
+}
+
+TEST(HLTables, Freeze)
+{
+    EasyLua::Table table;
+
+    for (int iteration = 0; iteration < 1000; ++iteration)
+        table.set("Key" + std::to_string(iteration), iteration);
+    table.set("Name", "Frozen");
+
+    table.freeze();
+    EXPECT_TRUE(table.isFrozen());
+
+    for (int iteration = 0; iteration < 1000; ++iteration)
+    {
+        int value = -1;
+        EXPECT_NO_THROW(table.get("Key" + std::to_string(iteration), value));
+        EXPECT_EQ(iteration, value);
+    }
+
+    std::string name;
+    EXPECT_NO_THROW(table.get("Name", name));
+    EXPECT_EQ("Frozen", name);
+
+    int missing = -1;
+    EXPECT_THROW(table.get("Missing", missing), std::out_of_range);
+    EXPECT_THROW(table.get("Name", missing), std::runtime_error);
+
+    // Mutating unfreezes
+    table.set("Another", 1);
+    EXPECT_FALSE(table.isFrozen());
+
+    int another = -1;
+    EXPECT_NO_THROW(table.get("Another", another));
+    EXPECT_EQ(1, another);
+}
+
+TEST(HLTables, Iteration)
+{
+    EasyLua::Table table;
+    table.set("Integer", 42);
+    table.set("Float", 3.5f);
+    table.set("String", "Text");
+
+    EasyLua::Table* child = new EasyLua::Table();
+    child->set("Depth", 1);
+    table.setTable("Child", *child);
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        // The same entries are seen whether or not the table is frozen
+        if (pass == 1)
+            table.freeze();
+
+        std::map<std::string, EasyLua::EASYLUA_TYPE> seen;
+        for (const EasyLua::Table::Entry& entry : table)
+            seen[std::string(entry.first)] = entry.second.type();
+
+        ASSERT_EQ(4, seen.size());
+        EXPECT_EQ(table.size(), seen.size());
+        EXPECT_EQ(EasyLua::EASYLUA_INTEGER, seen["Integer"]);
+        EXPECT_EQ(EasyLua::EASYLUA_FLOAT, seen["Float"]);
+        EXPECT_EQ(EasyLua::EASYLUA_STRING, seen["String"]);
+        EXPECT_EQ(EasyLua::EASYLUA_TABLE, seen["Child"]);
+
+        // Views point at the stored values
+        const int* integer = table.tryGet<int>("Integer");
+        ASSERT_NE(nullptr, integer);
+        EXPECT_EQ(42, *integer);
+        EXPECT_EQ("Text", *table.tryGet<std::string>("String"));
+        EXPECT_EQ(nullptr, table.tryGet<int>("String"));
+        EXPECT_EQ(nullptr, table.tryGet<int>("Missing"));
+
+        const EasyLua::Table* nested = table.tryGet<EasyLua::Table>("Child");
+        ASSERT_NE(nullptr, nested);
+        EXPECT_EQ(1, *nested->tryGet<int>("Depth"));
+
+        int integers = 0;
+        float floats = 0.0f;
+        std::string strings;
+        size_t tables = 0;
+
+        struct Visitor
+        {
+            int& integers;
+            float& floats;
+            std::string& strings;
+            size_t& tables;
+
+            void operator()(std::string_view key, const int& value) { integers += value; }
+            void operator()(std::string_view key, const float& value) { floats += value; }
+            void operator()(std::string_view key, std::string_view value) { strings.append(value); }
+            void operator()(std::string_view key, const EasyLua::Table& value) { tables += value.size(); }
+        };
+
+        EXPECT_TRUE(table.visit(Visitor{integers, floats, strings, tables}));
+        EXPECT_EQ(42, integers);
+        EXPECT_EQ(3.5f, floats);
+        EXPECT_EQ("Text", strings);
+        EXPECT_EQ(1, tables);
+
+        // Returning false stops the walk
+        int visited = 0;
+        EXPECT_FALSE(table.visit([&visited](std::string_view key, std::string_view value) {
+            ++visited;
+            return false;
+        }));
+        EXPECT_EQ(1, visited);
+
+        // Values are only passed to overloads of their exact type, never converted
+        size_t converted = 0;
+        EXPECT_TRUE(table.visit([&converted](std::string_view key, const float& value) { ++converted; }));
+        EXPECT_EQ(1, converted);
+        EXPECT_TRUE(table.visit([&converted](std::string_view key, const int& value) { ++converted; }));
+        EXPECT_EQ(2, converted);
+    }
+
+    // Integers are never converted for a visitor that only takes floats, nor the other way around
+    EasyLua::Table integers;
+    integers.set("One", 1);
+    integers.set("Two", 2);
+
+    size_t floatCalls = 0;
+    EXPECT_TRUE(integers.visit([&floatCalls](std::string_view key, const float& value) { ++floatCalls; }));
+    EXPECT_EQ(0, floatCalls);
+
+    EasyLua::Table floats;
+    floats.set("Half", 0.5f);
+
+    size_t integerCalls = 0;
+    EXPECT_TRUE(floats.visit([&integerCalls](std::string_view key, int value) { ++integerCalls; }));
+    EXPECT_EQ(0, integerCalls);
+
+    EasyLua::Table empty;
+    EXPECT_TRUE(empty.begin() == empty.end());
+    empty.freeze();
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
@@ -0,0 +1,157 @@
+/**
+ *  @file test_mapped.cpp
+ *  @brief Source file testing the binary Table format and its memory mapped views.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <easylua_mapped.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Mapped, RoundTrip)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "easylua_mapped_test.bin").string();
+
+    {
+        EasyLua::Table sub;
+        sub.set("Deep", -7);
+
+        EasyLua::Table root;
+        root.set("Name", "Rules");
+        root.set("Count", 42);
+        root.set("Ratio", 0.25f);
+        root.set("Sub", sub);
+        root.serialize(path);
+    }
+
+    {
+        EasyLua::TableMapping mapping(path);
+        const EasyLua::MappedTable& view = mapping.root();
+
+        EXPECT_EQ(4, view.size());
+        EXPECT_TRUE(view.contains("Sub"));
+        EXPECT_EQ(EasyLua::EASYLUA_TABLE, view.type("Sub"));
+
+        int count = 0;
+        view.get("Count", count);
+        EXPECT_EQ(42, count);
+
+        float ratio = 0;
+        view.get("Ratio", ratio);
+        EXPECT_EQ(0.25f, ratio);
+
+        std::string_view name;
+        view.get("Name", name);
+        EXPECT_EQ("Rules", name);
+
+        EasyLua::MappedTable sub;
+        view.get("Sub", sub);
+
+        int deep = 0;
+        sub.get("Deep", deep);
+        EXPECT_EQ(-7, deep);
+
+        EXPECT_THROW(view.get("Missing", count), std::out_of_range);
+        EXPECT_THROW(view.get("Name", count), std::runtime_error);
+
+        // Init Lua
+        lua_State *lua = luaL_newstate();
+        luaL_checkversion(lua);
+        luaL_openlibs(lua);
+
+        view.push(lua);
+        lua_setglobal(lua, "Root");
+
+        EXPECT_EQ(0, luaL_dostring(lua, "return Root.Name, Root.Count, Root.Ratio, Root.Sub.Deep"));
+        EXPECT_STREQ("Rules", lua_tostring(lua, 1));
+        EXPECT_EQ(42, lua_tointeger(lua, 2));
+        EXPECT_EQ(0.25, lua_tonumber(lua, 3));
+        EXPECT_EQ(-7, lua_tointeger(lua, 4));
+
+        lua_close(lua);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(Mapped, WideIntegers)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "easylua_mapped_wide_test.bin").string();
+
+    EasyLua::Table root;
+    root.set("Wide", 0x12345678);
+    std::string serialized = root.serialize();
+
+    // Tables only hold int, but the format stores 64 bits, so widen the stored value in place
+    const int64_t narrow = 0x12345678;
+    const int64_t wide = 0x123456789ALL;
+    const size_t offset = serialized.find(std::string(reinterpret_cast<const char*>(&narrow), sizeof(narrow)));
+    ASSERT_NE(std::string::npos, offset);
+    std::memcpy(&serialized[offset], &wide, sizeof(wide));
+
+    {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file << serialized;
+    }
+
+    {
+        EasyLua::TableMapping mapping(path);
+
+        int narrowed = 0;
+        EXPECT_THROW(mapping.root().get("Wide", narrowed), std::out_of_range);
+
+        lua_Integer value = 0;
+        mapping.root().get("Wide", value);
+        EXPECT_EQ(wide, value);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(Mapped, SelfReference)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "easylua_mapped_cycle_test.bin").string();
+
+    EasyLua::Table root;
+    root.set("Sub", EasyLua::Table());
+    std::string serialized = root.serialize();
+
+    // Point the only entry of the root node back at the root node itself
+    EasyLua::MappedFormat::Header header;
+    std::memcpy(&header, serialized.data(), sizeof(header));
+    const size_t value = static_cast<size_t>(header.root) + sizeof(uint64_t) + offsetof(EasyLua::MappedFormat::Entry, value);
+    std::memcpy(&serialized[value], &header.root, sizeof(header.root));
+
+    {
+        std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        file << serialized;
+    }
+
+    {
+        // Init Lua
+        lua_State *lua = luaL_newstate();
+        luaL_checkversion(lua);
+        luaL_openlibs(lua);
+
+        EasyLua::TableMapping mapping(path);
+        EXPECT_THROW(mapping.root().push(lua), std::runtime_error);
+        EXPECT_EQ(0, lua_gettop(lua));
+
+        lua_close(lua);
+    }
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,174 @@
+/**
+ *  @file test_memoize.cpp
+ *  @brief Source file testing the memoization cache for pure Lua functions.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <thread>
+
+#include <easylua_memoize.hpp>
+
+#include <gtest/gtest.h>
+
+static const char* RULES_SCRIPT =
+    "runs = 0\n"
+    "function score(entity, bonus) runs = runs + 1 return entity.hp * 2 + bonus, 'scored' end\n"
+    "function lookup(name) runs = runs + 1 return { name = name, size = #name } end\n"
+    "function identity(value) runs = runs + 1 return value end\n"
+    "function fail() runs = runs + 1 error('failed') end\n";
+
+static int runs(lua_State* lua)
+{
+    lua_getglobal(lua, "runs");
+    const int result = static_cast<int>(lua_tointeger(lua, -1));
+    lua_pop(lua, 1);
+    return result;
+}
+
+TEST(Memoize, Hits)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+    EXPECT_EQ(0, luaL_dostring(lua, RULES_SCRIPT));
+
+    EasyLua::Memoizer memoizer(lua, 16);
+    memoizer.setCacheable("score");
+    memoizer.setCacheable("lookup");
+    memoizer.setCacheable("identity");
+    memoizer.setCacheable("fail");
+
+    EasyLua::Table entity;
+    entity.set("hp", 10);
+
+    // Repeated arguments, tables included, skip the VM
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        EXPECT_EQ(2, memoizer.call("score", entity, 5));
+        EXPECT_EQ(25, lua_tointeger(lua, -2));
+        EXPECT_STREQ("scored", lua_tostring(lua, -1));
+        lua_pop(lua, 2);
+    }
+    EXPECT_EQ(1, runs(lua));
+
+    EXPECT_EQ(2, memoizer.call("score", entity, 6));
+    lua_pop(lua, 2);
+    EXPECT_EQ(2, runs(lua));
+
+    // Tables returned from the cache are fresh copies
+    const std::pair<int, size_t> first = memoizer.pcall("lookup", "alpha");
+    EXPECT_EQ(LUA_OK, first.first);
+    const std::pair<int, size_t> second = memoizer.pcall("lookup", "alpha");
+    EXPECT_EQ(1, second.second);
+    EXPECT_FALSE(lua_rawequal(lua, -1, -2));
+    lua_getfield(lua, -1, "size");
+    EXPECT_EQ(5, lua_tointeger(lua, -1));
+    lua_pop(lua, 3);
+    EXPECT_EQ(3, runs(lua));
+
+    // Failures and unencodable values are never cached
+    EXPECT_NE(LUA_OK, memoizer.pcall("fail").first);
+    lua_pop(lua, 1);
+    EXPECT_NE(LUA_OK, memoizer.pcall("fail").first);
+    lua_pop(lua, 1);
+    EXPECT_EQ(5, runs(lua));
+
+    EXPECT_EQ(1, memoizer.call("identity", static_cast<void*>(&memoizer)));
+    EXPECT_EQ(1, memoizer.call("identity", static_cast<void*>(&memoizer)));
+    EXPECT_TRUE(lua_islightuserdata(lua, -1));
+    lua_pop(lua, 2);
+    EXPECT_EQ(7, runs(lua));
+
+    lua_pushcfunction(lua, [](lua_State* lua) -> int { return 0; });
+    lua_setglobal(lua, "native");
+    EXPECT_EQ(0, luaL_dostring(lua, "function getNative() runs = runs + 1 return native end"));
+    memoizer.setCacheable("getNative");
+    EXPECT_EQ(1, memoizer.call("getNative"));
+    EXPECT_EQ(1, memoizer.call("getNative"));
+    lua_pop(lua, 2);
+
+    const EasyLua::Memoizer::Statistics& statistics = memoizer.statistics();
+    EXPECT_EQ(3, statistics.hits);
+    EXPECT_EQ(7, statistics.misses);
+    EXPECT_EQ(4, statistics.uncacheable);
+    EXPECT_EQ(3, memoizer.size());
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    lua_close(lua);
+}
+
+TEST(Memoize, Eviction)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+    EXPECT_EQ(0, luaL_dostring(lua, RULES_SCRIPT));
+
+    EasyLua::Memoizer memoizer(lua, 2);
+    memoizer.setCacheable("identity");
+
+    // Uncacheable functions pass straight through
+    EXPECT_EQ(2, memoizer.call("score", EasyLua::Utilities::makeTable("hp", 1), 0));
+    lua_pop(lua, 2);
+    EXPECT_EQ(0, memoizer.statistics().misses);
+
+    memoizer.call("identity", 1);
+    memoizer.call("identity", 2);
+    memoizer.call("identity", 1);
+    // Evicts 2, the least recently used
+    memoizer.call("identity", 3);
+    lua_settop(lua, 0);
+
+    EXPECT_EQ(1, memoizer.statistics().evictions);
+    EXPECT_EQ(2, memoizer.size());
+
+    const int before = runs(lua);
+    memoizer.call("identity", 1);
+    memoizer.call("identity", 3);
+    EXPECT_EQ(before, runs(lua));
+    memoizer.call("identity", 2);
+    EXPECT_EQ(before + 1, runs(lua));
+    lua_settop(lua, 0);
+
+    // Clearing a function drops only its entries
+    memoizer.clear("identity");
+    EXPECT_EQ(0, memoizer.size());
+
+    lua_close(lua);
+}
+
+TEST(Memoize, Expiry)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+    EXPECT_EQ(0, luaL_dostring(lua, RULES_SCRIPT));
+
+    EasyLua::Memoizer memoizer(lua, 8, std::chrono::milliseconds(20));
+    memoizer.setCacheable("identity");
+
+    memoizer.call("identity", "value");
+    memoizer.call("identity", "value");
+    EXPECT_EQ(1, runs(lua));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    memoizer.call("identity", "value");
+    EXPECT_EQ(2, runs(lua));
+    EXPECT_EQ(1, memoizer.statistics().expirations);
+    EXPECT_EQ(1, memoizer.statistics().hits);
+
+    memoizer.resetStatistics();
+    EXPECT_EQ(0, memoizer.statistics().misses);
+
+    lua_close(lua);
+}
@@ -0,0 +1,50 @@
+/**
+ *  @file test_memory.cpp
+ *  @brief Source file testing memory accounting for Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_memory.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Memory, Limits)
+{
+    EasyLua::MemoryAccount account(4 * 1024 * 1024, 2 * 1024 * 1024);
+
+    size_t softLimitCalls = 0;
+    account.setSoftLimitCallback([&softLimitCalls](EasyLua::MemoryAccount& crossed) { ++softLimitCalls; });
+
+    lua_State* lua = account.newState();
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(&account, EasyLua::MemoryAccount::get(lua));
+    EXPECT_GT(account.current(), 0);
+    EXPECT_GT(account.allocations(), 0);
+    EXPECT_EQ(0, softLimitCalls);
+
+    // A runaway script fails cleanly with a memory error
+    EXPECT_EQ(0, luaL_loadstring(lua, "local t = {} for i = 1, 1e9 do t[i] = string.rep('x', 64) .. i end"));
+    EXPECT_EQ(LUA_ERRMEM, lua_pcall(lua, 0, 0, 0));
+    lua_settop(lua, 0);
+
+    EXPECT_GT(account.failures(), 0);
+    EXPECT_LE(account.peak(), account.hardLimit());
+    EXPECT_EQ(1, softLimitCalls);
+
+    // The state remains usable once the garbage is gone
+    lua_gc(lua, LUA_GCCOLLECT, 0);
+    EXPECT_LT(account.current(), account.softLimit());
+    EXPECT_EQ(0, luaL_dostring(lua, "return 1 + 1"));
+    EXPECT_EQ(2, lua_tointeger(lua, -1));
+
+    lua_close(lua);
+    EXPECT_EQ(0, account.current());
+    EXPECT_EQ(account.allocations(), account.frees());
+}
@@ -0,0 +1,107 @@
+/**
+ *  @file test_methods.cpp
+ *  @brief Source file testing cached object and method references.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_methods.hpp>
+
+#include <gtest/gtest.h>
+
+static const char* ENTITY_SCRIPT =
+    "Entity = {}\n"
+    "Entity.__index = Entity\n"
+    "function Entity.new(x) return setmetatable({ x = x }, Entity) end\n"
+    "function Entity:update(dt) self.x = self.x + dt return self.x end\n"
+    "function Entity:fail() error('failed') end\n"
+    "entity = Entity.new(1)\n";
+
+TEST(Methods, Call)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, ENTITY_SCRIPT));
+
+    lua_getglobal(lua, "entity");
+    EasyLua::ObjectRef entity(lua, -1);
+    lua_pop(lua, 1);
+
+    // Methods are found through the metatable and self is passed implicitly
+    EasyLua::MethodRef update(entity, "update");
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        EXPECT_EQ(1, update.call(2));
+        lua_pop(lua, 1);
+    }
+
+    EXPECT_EQ(1, update.call(0.5));
+    EXPECT_EQ(7.5, lua_tonumber(lua, -1));
+    lua_pop(lua, 1);
+
+    EasyLua::MethodRef fail(entity, "fail");
+    const std::pair<int, size_t> result = fail.pcall();
+    EXPECT_NE(LUA_OK, result.first);
+    EXPECT_EQ(1, result.second);
+    lua_pop(lua, 1);
+
+    // Missing methods throw without touching the stack
+    EasyLua::MethodRef missing(entity, "missing");
+    EXPECT_THROW(missing.call(), std::runtime_error);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    lua_close(lua);
+}
+
+TEST(Methods, Invalidation)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, ENTITY_SCRIPT));
+
+    lua_getglobal(lua, "entity");
+    EasyLua::ObjectRef entity(lua, -1);
+    lua_pop(lua, 1);
+
+    EasyLua::MethodRef update(entity, "update");
+    EasyLua::MethodRef fail(entity, "fail");
+    EXPECT_EQ(1, update.call(1));
+    lua_pop(lua, 1);
+
+    // Dropping the object drops every bound method with it
+    entity.invalidate();
+    EXPECT_FALSE(entity.isValid());
+    EXPECT_FALSE(update.isValid());
+    EXPECT_FALSE(fail.isValid());
+    EXPECT_THROW(update.call(1), std::runtime_error);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    // Methods may also outlive their object
+    {
+        lua_getglobal(lua, "entity");
+        EasyLua::ObjectRef temporary(lua, -1);
+        lua_pop(lua, 1);
+
+        EasyLua::MethodRef bound(temporary, "update");
+        // This one is destroyed after its object was invalidated
+        EasyLua::MethodRef* dangling = new EasyLua::MethodRef(temporary, "update");
+        EXPECT_EQ(1, dangling->call(1));
+        lua_pop(lua, 1);
+
+        temporary.invalidate();
+        delete dangling;
+    }
+
+    lua_close(lua);
+}
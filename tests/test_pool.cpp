@@ -0,0 +1,60 @@
+/**
+ *  @file test_pool.cpp
+ *  @brief Source file testing pools of recyclable Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_pool.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Pool, Reset)
+{
+    size_t created = 0;
+
+    EasyLua::StatePool pool([&created](lua_State* lua)
+    {
+        luaL_openlibs(lua);
+        luaL_dostring(lua, "Counter = 1 function double(x) return x * 2 end");
+        ++created;
+    });
+
+    pool.reserve(1);
+    EXPECT_EQ(1, pool.idle());
+
+    lua_State* lua = pool.acquire();
+    EXPECT_EQ(0, pool.idle());
+
+    // Dirty the state every way a request might
+    EXPECT_EQ(0, luaL_dostring(lua, "Counter = 5 Leaked = true string.upper = nil double = nil setmetatable(_G, { __index = function() return 1 end })"));
+    lua_pushinteger(lua, 10);
+    const int reference = luaL_ref(lua, LUA_REGISTRYINDEX);
+    lua_pushinteger(lua, 20);
+
+    pool.release(lua);
+    EXPECT_EQ(1, pool.idle());
+
+    // The same state comes back, as it was after setup
+    EXPECT_EQ(lua, pool.acquire());
+    EXPECT_EQ(1, created);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return Counter, Leaked, string.upper('a'), double(4), getmetatable(_G)"));
+    EXPECT_EQ(1, lua_tointeger(lua, 1));
+    EXPECT_TRUE(lua_isnil(lua, 2));
+    EXPECT_STREQ("A", lua_tostring(lua, 3));
+    EXPECT_EQ(8, lua_tointeger(lua, 4));
+    EXPECT_TRUE(lua_isnil(lua, 5));
+    lua_settop(lua, 0);
+
+    EXPECT_EQ(LUA_TNIL, lua_rawgeti(lua, LUA_REGISTRYINDEX, reference));
+    lua_pop(lua, 1);
+
+    pool.release(lua);
+}
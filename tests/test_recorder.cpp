@@ -0,0 +1,167 @@
+/**
+ *  @file test_recorder.cpp
+ *  @brief Source file testing the call recorder, the offline replayer and the value codec.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <limits>
+
+#include <easylua_codec.hpp>
+#include <easylua_recorder.hpp>
+
+#include <gtest/gtest.h>
+
+static const char* SCORING_SCRIPT =
+    "total = 0\n"
+    "function score(entity, bonus) total = total + entity.hp * 2 + bonus return total end\n"
+    "function fail() error('failed') end\n"
+    "function outer() return inner() + 1 end\n";
+
+static lua_State* createState(void)
+{
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, SCORING_SCRIPT));
+
+    // inner is called back into through the call layer
+    lua_register(lua, "inner", [](lua_State* lua) -> int {
+        EasyLua::call(lua, "fail_free");
+        lua_pushinteger(lua, 41);
+        return 1;
+    });
+    EXPECT_EQ(0, luaL_dostring(lua, "function fail_free() end"));
+    return lua;
+}
+
+TEST(Recorder, Codec)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "return 1, 2.5, 'text', true, nil, { a = 1, b = { 'x', 'y' }, [3] = false }, print"));
+    EXPECT_EQ(7, lua_gettop(lua));
+
+    std::string encoded;
+    EXPECT_FALSE(EasyLua::ValueCodec::encode(lua, 1, 7, encoded));
+    lua_settop(lua, 0);
+
+    EXPECT_EQ(7, EasyLua::ValueCodec::decode(lua, encoded));
+    EXPECT_TRUE(lua_isinteger(lua, 1));
+    EXPECT_EQ(1, lua_tointeger(lua, 1));
+    EXPECT_EQ(2.5, lua_tonumber(lua, 2));
+    EXPECT_STREQ("text", lua_tostring(lua, 3));
+    EXPECT_TRUE(lua_toboolean(lua, 4));
+    EXPECT_TRUE(lua_isnil(lua, 5));
+    EXPECT_TRUE(lua_isnil(lua, 7));
+
+    lua_getfield(lua, 6, "b");
+    lua_rawgeti(lua, -1, 2);
+    EXPECT_STREQ("y", lua_tostring(lua, -1));
+    lua_settop(lua, 0);
+
+    // Equal tables encode identically regardless of how they were built
+    EXPECT_EQ(0, luaL_dostring(lua, "local a = {} for i = 1, 50 do a['k' .. i] = i end local b = {} for i = 50, 1, -1 do b['k' .. i] = i end return a, b"));
+    std::string first;
+    std::string second;
+    EXPECT_TRUE(EasyLua::ValueCodec::encode(lua, 1, first));
+    EXPECT_TRUE(EasyLua::ValueCodec::encode(lua, 2, second));
+    EXPECT_EQ(first, second);
+    lua_settop(lua, 0);
+
+    // Malformed encodings leave nothing behind
+    EXPECT_THROW(EasyLua::ValueCodec::decode(lua, first.substr(0, first.size() - 3)), std::runtime_error);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    // Including tables keyed by NaN, which Lua itself refuses to store
+    std::string nanKey(1, static_cast<char>(EasyLua::ValueCodec::TAG_TABLE));
+    EasyLua::ValueCodec::writeRaw(nanKey, static_cast<uint32_t>(1));
+    nanKey.push_back(static_cast<char>(EasyLua::ValueCodec::TAG_NUMBER));
+    EasyLua::ValueCodec::writeRaw(nanKey, std::numeric_limits<double>::quiet_NaN());
+    nanKey.push_back(static_cast<char>(EasyLua::ValueCodec::TAG_TRUE));
+
+    EXPECT_THROW(EasyLua::ValueCodec::decode(lua, nanKey), std::runtime_error);
+    EXPECT_EQ(0, lua_gettop(lua));
+
+    lua_close(lua);
+}
+
+TEST(Recorder, RecordAndReplay)
+{
+    lua_State* lua = createState();
+    std::string log;
+
+    {
+        EasyLua::Recorder recorder(lua);
+        EXPECT_THROW(EasyLua::Recorder second(lua), std::runtime_error);
+
+        EasyLua::Table entity;
+        entity.set("hp", 10);
+
+        for (int iteration = 0; iteration < 3; ++iteration)
+        {
+            EXPECT_EQ(1, EasyLua::call(lua, "score", entity, iteration));
+            lua_pop(lua, 1);
+        }
+
+        const std::pair<int, size_t> failed = EasyLua::pcall(lua, "fail");
+        EXPECT_NE(LUA_OK, failed.first);
+        lua_pop(lua, static_cast<int>(failed.second));
+
+        // Only the outermost call is recorded
+        EXPECT_EQ(1, EasyLua::call(lua, "outer"));
+        EXPECT_EQ(42, lua_tointeger(lua, -1));
+        lua_pop(lua, 1);
+
+        const std::vector<EasyLua::RecordedCall>& calls = recorder.calls();
+        ASSERT_EQ(5, calls.size());
+        EXPECT_EQ("score", calls[0].name);
+        EXPECT_EQ(2, calls[0].parameterCount);
+        EXPECT_EQ(LUA_OK, calls[0].status);
+        EXPECT_NE(LUA_OK, calls[3].status);
+        EXPECT_EQ("outer", calls[4].name);
+
+        log = recorder.serialize();
+    }
+
+    // Nothing is recorded once the recorder is gone
+    EXPECT_EQ(1, EasyLua::call(lua, "outer"));
+    lua_close(lua);
+
+    // Replay against a fresh state loaded with the same scripts
+    EasyLua::Replayer replayer(log);
+    ASSERT_EQ(5, replayer.calls().size());
+
+    lua_State* fresh = createState();
+    const std::map<std::string, EasyLua::ReplayStatistics> statistics = replayer.replay(fresh, 2);
+    EXPECT_EQ(0, lua_gettop(fresh));
+
+    ASSERT_EQ(3, statistics.size());
+    EXPECT_EQ(6, statistics.at("score").calls);
+    EXPECT_EQ(0, statistics.at("score").failures);
+    EXPECT_EQ(2, statistics.at("fail").failures);
+    EXPECT_LE(statistics.at("outer").fastest, statistics.at("outer").slowest);
+
+    // The parameters, tables included, were replayed faithfully: 2 * (sum of 20 + i for i in 0..2)
+    lua_getglobal(fresh, "total");
+    EXPECT_EQ(126, lua_tointeger(fresh, -1));
+    lua_pop(fresh, 1);
+
+    const std::string report = EasyLua::Replayer::report(statistics);
+    EXPECT_NE(std::string::npos, report.find("score"));
+    EXPECT_NE(std::string::npos, report.find("outer"));
+
+    EXPECT_THROW(EasyLua::Replayer(log.substr(0, log.size() - 1)), std::runtime_error);
+    EXPECT_THROW(EasyLua::Replayer("garbage"), std::runtime_error);
+
+    lua_close(fresh);
+}
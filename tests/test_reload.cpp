@@ -0,0 +1,107 @@
+/**
+ *  @file test_reload.cpp
+ *  @brief Source file testing background script hot-reloading.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <easylua_reload.hpp>
+
+#include <gtest/gtest.h>
+
+static void writeScript(const std::string& path, const std::string& contents)
+{
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    file << contents;
+}
+
+TEST(Reload, Swap)
+{
+    const std::string path = (std::filesystem::temp_directory_path() / "easylua_reload_test.lua").string();
+    writeScript(path, "function value() return 1 end");
+
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    {
+        EasyLua::ScriptReloader reloader;
+        reloader.watch(path);
+
+        // Nothing compiled yet, so updating is a no-op
+        EXPECT_EQ(0, reloader.update(lua));
+
+        EXPECT_EQ(1, reloader.poll());
+        EXPECT_EQ(1, reloader.update(lua));
+        EXPECT_EQ(0, reloader.update(lua));
+
+        EasyLua::FunctionRef value(lua, "value", &reloader);
+        EXPECT_EQ(1, value.call());
+        EXPECT_EQ(1, lua_tointeger(lua, -1));
+        lua_pop(lua, 1);
+
+        // Make sure the modification time actually changes
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(2));
+        writeScript(path, "function value() return 2 end");
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(4));
+
+        EXPECT_EQ(1, reloader.poll());
+        EXPECT_EQ(0, reloader.poll());
+
+        // Still the old function until the state reaches a safe point
+        EXPECT_EQ(1, value.call());
+        EXPECT_EQ(1, lua_tointeger(lua, -1));
+        lua_pop(lua, 1);
+
+        EXPECT_EQ(1, reloader.update(lua));
+        EXPECT_EQ(1, value.call());
+        EXPECT_EQ(2, lua_tointeger(lua, -1));
+        lua_pop(lua, 1);
+
+        // Broken scripts report their error and keep the last good version
+        writeScript(path, "function value() return end end");
+        std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(6));
+
+        EXPECT_EQ(0, reloader.poll());
+        EXPECT_FALSE(reloader.error(path).empty());
+        EXPECT_EQ(0, reloader.update(lua));
+    }
+
+    EXPECT_EQ(0, lua_gettop(lua));
+    lua_close(lua);
+    std::filesystem::remove(path);
+}
+
+TEST(Reload, LateDefinition)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    {
+        // Functions that do not exist yet are not cached as nil
+        EasyLua::FunctionRef late(lua, "late");
+        late.push();
+        EXPECT_TRUE(lua_isnil(lua, -1));
+        lua_pop(lua, 1);
+
+        EXPECT_EQ(0, luaL_dostring(lua, "function late() return 3 end"));
+        EXPECT_EQ(1, late.call());
+        EXPECT_EQ(3, lua_tointeger(lua, -1));
+        lua_pop(lua, 1);
+    }
+
+    lua_close(lua);
+}
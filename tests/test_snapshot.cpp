@@ -0,0 +1,81 @@
+/**
+ *  @file test_snapshot.cpp
+ *  @brief Source file testing shared snapshots across Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_snapshot.hpp>
+
+#include <gtest/gtest.h>
+
+static bool runCheck(lua_State* lua, const char* code)
+{
+    if (luaL_dostring(lua, code) != 0)
+        return false;
+
+    const bool result = lua_toboolean(lua, -1) != 0;
+    lua_pop(lua, 1);
+    return result;
+}
+
+TEST(Snapshot, SharedAcrossStates)
+{
+    EasyLua::SnapshotStore store;
+
+    {
+        EasyLua::Table table;
+        EasyLua::Table* subTable = new EasyLua::Table();
+
+        table.set("Version", 1);
+        table.set("Name", "First");
+        subTable->set("Ratio", 0.5f);
+        table.setTable("Sub", *subTable);
+
+        store.publish(table);
+    }
+
+    EXPECT_EQ(1, store.version());
+
+    lua_State* states[2];
+
+    for (lua_State*& lua : states)
+    {
+        lua = luaL_newstate();
+        luaL_openlibs(lua);
+
+        store.push(lua);
+        lua_setglobal(lua, "shared");
+
+        EXPECT_TRUE(runCheck(lua, "local count = 0 for _ in pairs(shared) do count = count + 1 end "
+                                  "return shared.Version == 1 and shared.Name == 'First' and shared.Sub.Ratio == 0.5 and #shared == 3 and count == 3"));
+        EXPECT_TRUE(runCheck(lua, "oldSub = shared.Sub return true"));
+    }
+
+    // Publishing swaps the data underneath every state at once
+    {
+        EasyLua::Table table;
+        table.set("Version", 2);
+        store.publish(table);
+    }
+
+    EXPECT_EQ(2, store.version());
+
+    for (lua_State* lua : states)
+    {
+        EXPECT_TRUE(runCheck(lua, "return shared.Version == 2 and shared.Name == nil"));
+
+        // Subtables read earlier stay on the version they came from
+        EXPECT_TRUE(runCheck(lua, "return oldSub.Ratio == 0.5"));
+    }
+
+    for (lua_State* lua : states)
+        lua_close(lua);
+
+    EXPECT_EQ(0, store.reclaim());
+}
@@ -0,0 +1,150 @@
+/**
+ *  @file test_stack.cpp
+ *  @brief Source file testing stack guards, stack reservation and stack balance of the call layer.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua.hpp>
+
+#include <gtest/gtest.h>
+
+static_assert(EasyLua::Resolvers::ReadCountResolver<>::value == 0, "Nothing reads no values");
+static_assert(EasyLua::Resolvers::ReadCountResolver<int*, float*>::value == 2, "Every output reads one value");
+static_assert(EasyLua::Resolvers::ReadCountResolver<int*, char*, int, std::string*>::value == 3, "Buffers read one value");
+static_assert(EasyLua::Resolvers::ReadCountResolver<char*, char*>::value == 2, "Characters are outputs too");
+
+//! Pushes the given number of integers with a single variadic push.
+template <size_t... indices>
+static void pushMany(lua_State* lua, std::index_sequence<indices...>)
+{
+    EasyLua::Utilities::pushParameters(lua, static_cast<int>(indices)...);
+}
+
+TEST(Stack, Guard)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    lua_pushinteger(lua, 1);
+
+    {
+        EasyLua::StackGuard guard(lua);
+        lua_pushinteger(lua, 2);
+        lua_pushinteger(lua, 3);
+
+        EXPECT_EQ(1, guard.top());
+        EXPECT_EQ(2, guard.pushed());
+    }
+    EXPECT_EQ(1, lua_gettop(lua));
+
+    // Exceptions unwinding through the guard restore the stack as well
+    try
+    {
+        EasyLua::StackGuard guard(lua);
+        lua_pushinteger(lua, 2);
+        throw std::runtime_error("unwind");
+    }
+    catch (std::runtime_error& e) { }
+    EXPECT_EQ(1, lua_gettop(lua));
+
+    // Released guards keep what was pushed
+    {
+        EasyLua::StackGuard guard(lua);
+        lua_pushinteger(lua, 2);
+        guard.release();
+    }
+    EXPECT_EQ(2, lua_gettop(lua));
+
+    lua_close(lua);
+}
+
+TEST(Stack, Reservation)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    // Far more values than the LUA_MINSTACK slots guaranteed without growing the stack
+    pushMany(lua, std::make_index_sequence<300>());
+    ASSERT_EQ(300, lua_gettop(lua));
+    EXPECT_EQ(299, lua_tointeger(lua, -1));
+    lua_settop(lua, 0);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "function count(...) return select('#', ...) end"));
+    EXPECT_EQ(1, EasyLua::call(lua, "count", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25));
+    EXPECT_EQ(25, lua_tointeger(lua, -1));
+    lua_settop(lua, 0);
+
+    // Reads fail up front, before anything is written
+    lua_pushinteger(lua, 1);
+    int first = 0;
+    int second = 0;
+    char buffer[16];
+    EXPECT_THROW(EasyLua::Utilities::readStack<true>(lua, &first, &second), std::runtime_error);
+    EXPECT_EQ(0, first);
+    EXPECT_THROW(EasyLua::Utilities::readStack<true>(lua, &first, buffer, static_cast<int>(sizeof(buffer))), std::runtime_error);
+    EXPECT_EQ(-1, EasyLua::Utilities::readStack<true>(lua, &first));
+    EXPECT_EQ(1, first);
+
+    lua_close(lua);
+}
+
+TEST(Stack, CallBalance)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dostring(lua, "function add(a, b) return a + b end\n"
+                                    "function handler(message) return 'handled' end\n"
+                                    "function fail(a, b) error('failed') end\n"));
+
+    // Values below the parameters must stay where they are
+    lua_pushstring(lua, "below");
+    lua_pushinteger(lua, 2);
+    lua_pushinteger(lua, 3);
+
+    EXPECT_EQ(1, EasyLua::call(lua, "add", static_cast<EasyLua::ParameterCount>(2)));
+    ASSERT_EQ(2, lua_gettop(lua));
+    EXPECT_STREQ("below", lua_tostring(lua, 1));
+    EXPECT_EQ(5, lua_tointeger(lua, 2));
+    lua_pop(lua, 1);
+
+    lua_pushinteger(lua, 4);
+    lua_pushinteger(lua, 5);
+    std::pair<int, size_t> result = EasyLua::pcall(lua, "add", static_cast<EasyLua::ParameterCount>(2));
+    EXPECT_EQ(LUA_OK, result.first);
+    EXPECT_EQ(1, result.second);
+    EXPECT_EQ(9, lua_tointeger(lua, -1));
+    lua_pop(lua, 1);
+
+    // Error handlers are used regardless of the number of parameters
+    lua_pushinteger(lua, 1);
+    lua_pushinteger(lua, 2);
+    result = EasyLua::pcall(lua, "fail", "handler", static_cast<EasyLua::ParameterCount>(2));
+    EXPECT_NE(LUA_OK, result.first);
+    EXPECT_EQ(2, result.second);
+    EXPECT_STREQ("handled", lua_tostring(lua, -1));
+    lua_pop(lua, static_cast<int>(result.second));
+
+    result = EasyLua::pcall(lua, "fail", "handler", 1, 2, 3);
+    EXPECT_NE(LUA_OK, result.first);
+    EXPECT_EQ(2, result.second);
+    EXPECT_STREQ("handled", lua_tostring(lua, -1));
+    lua_pop(lua, static_cast<int>(result.second));
+
+    ASSERT_EQ(1, lua_gettop(lua));
+    EXPECT_STREQ("below", lua_tostring(lua, 1));
+
+    lua_close(lua);
+}
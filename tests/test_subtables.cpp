@@ -65,3 +65,30 @@ TEST(Subtables, Basic)
     // Deinit
     lua_close(lua);
 }
+
+TEST(Subtables, NonEmptyStack)
+{
+    // Init Lua
+    lua_State *lua = luaL_newstate();
+    luaL_checkversion(lua);
+    luaL_openlibs(lua);
+
+    EXPECT_EQ(0, luaL_dofile(lua, "tests/main.lua"));
+
+    // Unrelated values already on the stack must not be disturbed by nested table pushes
+    lua_pushstring(lua, "Unrelated");
+    lua_pushinteger(lua, 42);
+
+    EasyLua::call(lua, "easyLuaSubTables",
+        EasyLua::Utilities::makeTable("Test", 3),
+        "One", 2, "Three", 4.12f, "Five", EasyLua::Utilities::makeTable("Six", 7,
+            "Eight", EasyLua::Utilities::makeTable("Nine", 10,
+                "Another", EasyLua::Utilities::makeTable("Table", 50))),
+        EasyLua::Utilities::makeTable("Ten", 11), 12, EasyLua::Utilities::makeTable("Thirteen", 14));
+
+    EXPECT_TRUE(lua_toboolean(lua, -1));
+    EXPECT_EQ(42, lua_tointeger(lua, 2));
+    EXPECT_STREQ("Unrelated", lua_tostring(lua, 1));
+
+    lua_close(lua);
+}
@@ -0,0 +1,92 @@
+/**
+ *  @file test_tasks.cpp
+ *  @brief Source file testing the work stealing task pool and parallel Table construction.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <string>
+
+#include <easylua_tasks.hpp>
+
+#include <gtest/gtest.h>
+
+static void fillTree(EasyLua::Table& out, const int& depth)
+{
+    for (int index = 0; index < 300; ++index)
+        out.set("Value" + std::to_string(index), index);
+
+    if (depth == 0)
+        return;
+
+    for (int index = 0; index < 4; ++index)
+    {
+        EasyLua::Table* child = new EasyLua::Table();
+        fillTree(*child, depth - 1);
+        out.setTable("Child" + std::to_string(index), *child);
+    }
+}
+
+TEST(Tasks, ParallelCopy)
+{
+    EasyLua::TaskPool pool(4);
+
+    EasyLua::Table source;
+    fillTree(source, 3);
+
+    EasyLua::Table copy;
+    copy.copy(source, pool);
+
+    EasyLua::Table child;
+    copy.get("Child2", child);
+    EasyLua::Table grandchild;
+    child.get("Child3", grandchild);
+
+    int value = 0;
+    grandchild.get("Value299", value);
+    EXPECT_EQ(299, value);
+
+    copy.get("Value7", value);
+    EXPECT_EQ(7, value);
+}
+
+TEST(Tasks, BulkBuilder)
+{
+    EasyLua::TaskPool pool(4);
+    EasyLua::BulkTableBuilder builder(pool);
+
+    for (int region = 0; region < 8; ++region)
+    {
+        builder.add("Region" + std::to_string(region), [region, &pool](EasyLua::Table& out)
+        {
+            // Nested builders share the pool
+            EasyLua::BulkTableBuilder inner(pool);
+
+            for (int zone = 0; zone < 4; ++zone)
+                inner.add("Zone" + std::to_string(zone), [region, zone](EasyLua::Table& zoneOut) { zoneOut.set("Id", region * 10 + zone); });
+
+            inner.build(out);
+        });
+    }
+
+    EasyLua::Table root;
+    builder.build(root);
+
+    EasyLua::Table region;
+    root.get("Region3", region);
+    EasyLua::Table zone;
+    region.get("Zone2", zone);
+
+    int id = 0;
+    zone.get("Id", id);
+    EXPECT_EQ(32, id);
+
+    // Failures surface on the building thread
+    builder.add("Broken", [](EasyLua::Table& out) { throw std::runtime_error("Broken!"); });
+    EXPECT_THROW(builder.build(root), std::runtime_error);
+}
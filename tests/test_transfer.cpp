@@ -0,0 +1,72 @@
+/**
+ *  @file test_transfer.cpp
+ *  @brief Source file testing direct value transfer between Lua states.
+ *
+ *  This software is licensed under the MIT license. Refer to LICENSE.txt for
+ *  more information.
+ *
+ *  @date 10/18/2026
+ *  @author Robert MacGregor
+ *  @copyright (c) 2026 Robert MacGregor
+ */
+
+#include <easylua_transfer.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(Transfer, Graph)
+{
+    // Init Lua
+    lua_State *source = luaL_newstate();
+    luaL_checkversion(source);
+    luaL_openlibs(source);
+
+    lua_State *destination = luaL_newstate();
+    luaL_checkversion(destination);
+    luaL_openlibs(destination);
+
+    EXPECT_EQ(0, luaL_dostring(source, "local long = string.rep('x', 100) "
+                                       "local shared = { 1, 2, 3 } "
+                                       "local root = { 10, 20.5, true, Name = 'Test', Shared = shared, Again = shared, Long = long, Long2 = long, Nested = { Deep = { 'd' } } } "
+                                       "root.Self = root "
+                                       "root[shared] = 'key' "
+                                       "return root"));
+
+    // Scalars go straight across
+    lua_pushinteger(source, 42);
+    EasyLua::transfer(source, -1, destination);
+    EXPECT_EQ(42, lua_tointeger(destination, -1));
+    EXPECT_TRUE(lua_isinteger(destination, -1));
+    lua_pop(source, 1);
+    lua_pop(destination, 1);
+
+    EasyLua::transfer(source, -1, destination);
+    EXPECT_EQ(1, lua_gettop(source));
+    EXPECT_EQ(1, lua_gettop(destination));
+    lua_setglobal(destination, "Root");
+
+    EXPECT_EQ(0, luaL_dostring(destination, "return Root[1], math.type(Root[1]), Root[2], Root[3], Root.Name, Root.Shared == Root.Again, Root.Self == Root, "
+                                            "#Root.Long, Root.Long == Root.Long2, Root.Nested.Deep[1], Root[Root.Shared], #Root.Shared"));
+    EXPECT_EQ(10, lua_tointeger(destination, 1));
+    EXPECT_STREQ("integer", lua_tostring(destination, 2));
+    EXPECT_EQ(20.5, lua_tonumber(destination, 3));
+    EXPECT_TRUE(lua_toboolean(destination, 4));
+    EXPECT_STREQ("Test", lua_tostring(destination, 5));
+    EXPECT_TRUE(lua_toboolean(destination, 6));
+    EXPECT_TRUE(lua_toboolean(destination, 7));
+    EXPECT_EQ(100, lua_tointeger(destination, 8));
+    EXPECT_TRUE(lua_toboolean(destination, 9));
+    EXPECT_STREQ("d", lua_tostring(destination, 10));
+    EXPECT_STREQ("key", lua_tostring(destination, 11));
+    EXPECT_EQ(3, lua_tointeger(destination, 12));
+    lua_settop(destination, 0);
+
+    // Unsupported values leave both stacks untouched
+    EXPECT_EQ(0, luaL_dostring(source, "return { 1, { print } }"));
+    EXPECT_THROW(EasyLua::transfer(source, -1, destination), std::runtime_error);
+    EXPECT_EQ(2, lua_gettop(source));
+    EXPECT_EQ(0, lua_gettop(destination));
+
+    lua_close(source);
+    lua_close(destination);
+}